@@ -0,0 +1,54 @@
+"""Print a Markdown table of flash and RAM usage per configuration profile.
+
+Reads the sketches reports written by arduino/compile-sketches, one report
+directory or file per profile, and prints one row per profile and sketch.
+
+Usage:
+    python size_table.py FULL=reports/full STANDARD=reports/standard MINIMAL=reports/minimal
+"""
+
+import glob
+import json
+import os
+import sys
+
+
+def load_reports(path):
+    files = glob.glob(os.path.join(path, "*.json")) if os.path.isdir(path) else [path]
+    for file in sorted(files):
+        with open(file) as f:
+            yield json.load(f)
+
+
+def sizes(sketch):
+    flash = ram = "n/a"
+    for size in sketch.get("sizes", []):
+        current = size.get("current", {}).get("absolute", "n/a")
+        if size["name"] == "flash":
+            flash = current
+        elif size["name"].startswith("RAM"):
+            ram = current
+    return flash, ram
+
+
+def main(args):
+    if not args:
+        print(__doc__.strip(), file=sys.stderr)
+        return 1
+    print("| Profile | Board | Sketch | Flash | RAM |")
+    print("|---------|-------|--------|-------|-----|")
+    for arg in args:
+        profile, _, path = arg.partition("=")
+        for report in load_reports(path):
+            for board in report.get("boards", []):
+                for sketch in board.get("sketches", []):
+                    if not sketch.get("compilation_success", False):
+                        flash, ram = "failed", "failed"
+                    else:
+                        flash, ram = sizes(sketch)
+                    print(f"| {profile} | {board['board']} | {sketch['name']} | {flash} | {ram} |")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,125 @@
+"""Decode the binary LcdMenu trace back into "#LOG# name=value" lines.
+
+Reads a serial port or a capture file (stdin by default) produced with
+`lcdMenuTrace().setBinary(true)`. Bytes outside of trace frames, such as
+the sketch's own Serial prints, are passed through unchanged.
+
+Usage:
+    python trace_decode.py [capture.bin] [--port /dev/ttyUSB0 --baud 9600] [--time]
+"""
+
+import argparse
+import struct
+import sys
+
+SYNC = 0xA5
+
+NONE, INT, UINT, FLOAT, CHAR, TEXT = range(6)
+
+
+class Decoder:
+    def __init__(self, out, show_time=False):
+        self.out = out
+        self.show_time = show_time
+        self.names = {}
+        self.buffer = bytearray()
+
+    def feed(self, data):
+        self.buffer += data
+        while self.buffer:
+            if self.buffer[0] != SYNC:
+                end = self.buffer.find(bytes([SYNC]))
+                end = len(self.buffer) if end < 0 else end
+                self.out.write(self.buffer[:end].decode("latin-1"))
+                del self.buffer[:end]
+                continue
+            used = self.frame()
+            if used == 0:
+                # Incomplete frame, wait for more data
+                return
+            del self.buffer[:used]
+
+    def frame(self):
+        b = self.buffer
+        if len(b) < 2:
+            return 0
+        kind = chr(b[1])
+        if kind == "D":
+            if len(b) < 4 or len(b) < 4 + b[3]:
+                return 0
+            self.names[b[2]] = b[4 : 4 + b[3]].decode("latin-1")
+            return 4 + b[3]
+        if kind == "X":
+            if len(b) < 4:
+                return 0
+            self.line("LcdMenuTrace::dropped", str(b[2] | b[3] << 8), None)
+            return 4
+        if kind == "E":
+            if len(b) < 8:
+                return 0
+            slot, kind_of_value = b[2], b[3]
+            (time,) = struct.unpack_from("<I", b, 4)
+            size, value = self.value(kind_of_value, 8)
+            if size is None:
+                return 0
+            self.line(self.names.get(slot, "?%d" % slot), value, time)
+            return 8 + size
+        # Not a frame, pass the sync byte through
+        self.out.write(chr(SYNC))
+        return 1
+
+    def value(self, kind, at):
+        b = self.buffer
+        if kind == NONE:
+            return 0, None
+        if kind in (INT, UINT, FLOAT):
+            if len(b) < at + 4:
+                return None, None
+            fmt = {INT: "<i", UINT: "<I", FLOAT: "<f"}[kind]
+            (v,) = struct.unpack_from(fmt, b, at)
+            # Same as Print::print(float)
+            return 4, "%.2f" % v if kind == FLOAT else str(v)
+        if kind == CHAR:
+            if len(b) < at + 1:
+                return None, None
+            return 1, chr(b[at])
+        if kind == TEXT:
+            if len(b) < at + 1 or len(b) < at + 1 + b[at]:
+                return None, None
+            return 1 + b[at], b[at + 1 : at + 1 + b[at]].decode("latin-1")
+        return 0, "?"
+
+    def line(self, name, value, time):
+        prefix = "[%10u] " % time if self.show_time and time is not None else ""
+        suffix = "" if value is None else "=" + value
+        self.out.write("%s#LOG# %s%s\n" % (prefix, name, suffix))
+        self.out.flush()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("file", nargs="?", help="capture file, stdin if omitted")
+    parser.add_argument("--port", help="serial port to read from (needs pyserial)")
+    parser.add_argument("--baud", type=int, default=9600)
+    parser.add_argument("--time", action="store_true", help="prefix lines with the event time in ms")
+    args = parser.parse_args()
+
+    decoder = Decoder(sys.stdout, args.time)
+    if args.port:
+        import serial
+
+        with serial.Serial(args.port, args.baud) as port:
+            while True:
+                decoder.feed(port.read(max(1, port.in_waiting)))
+    else:
+        source = open(args.file, "rb") if args.file else sys.stdin.buffer
+        with source:
+            while True:
+                data = source.read(256)
+                if not data:
+                    break
+                decoder.feed(data)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,496 @@
+/*
+  LcdMenu command stream fuzzer.
+
+  Feeds random and recorded command streams through `LcdMenu::process` on a
+  menu that holds every item type, checks the menu invariants after every
+  command and reports the slowest command of each type as JSON.
+
+  Usage: lcdmenu_fuzz [--seeds N | --seed S] [--commands N] [--replay FILE]...
+                      [--save FILE] [--output FILE]
+
+  Recorded streams are text files of whitespace separated commands: `UP`,
+  `DOWN`, `LEFT`, `RIGHT`, `ENTER`, `BACK`, `BACKSPACE`, `CLEAR`, `POLL`, a
+  single character, or `0xNN` for any byte. `TOKEN*N` repeats a command N
+  times, `#` starts a comment and `+Nms` delays are ignored. The end of a
+  failing stream is printed in the same format, `--save` writes the whole
+  stream so it can be added to `corpus/`.
+
+  Built with -DLCDMENU_LIBFUZZER=ON the same checks run as a libFuzzer target
+  whose input bytes are the commands.
+*/
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "../test/support/AllocationCounter.h"
+#include "support/BenchDisplay.h"
+
+#include <ItemBack.h>
+#include <ItemBool.h>
+#include <ItemCommand.h>
+#include <ItemInputCharset.h>
+#include <ItemLabel.h>
+#include <ItemList.h>
+#include <ItemRange.h>
+#include <ItemSubMenu.h>
+#include <ItemToggle.h>
+#include <ItemValue.h>
+#include <ItemWidget.h>
+#include <LcdMenu.h>
+#include <MenuScreen.h>
+#include <diagnostics/LatencyProbe.h>
+#include <renderer/CharacterDisplayRenderer.h>
+#include <widget/WidgetList.h>
+#include <widget/WidgetRange.h>
+
+#ifndef LCDMENU_VERSION
+#define LCDMENU_VERSION "unknown"
+#endif
+
+namespace {
+
+/**
+ * @brief Pseudo command that advances the clock by a second and polls the menu.
+ */
+const int POLL = -1;
+
+typedef std::vector<int> Commands;
+
+/**
+ * @brief Counting display that also checks the cursor stays on the display.
+ */
+class CheckedDisplay : public BenchDisplay {
+  public:
+    uint8_t cols;
+    uint8_t rows;
+    unsigned long outOfBounds = 0;
+
+    CheckedDisplay(uint8_t cols, uint8_t rows) : cols(cols), rows(rows) {}
+
+    void setCursor(uint8_t col, uint8_t row) override {
+        if (col >= cols || row >= rows) outOfBounds++;
+        BenchDisplay::setCursor(col, row);
+    }
+};
+
+const std::vector<const char*> days = {"Mon", "Tue", "Wed", "Thu", "Fri", "Sat", "Sun"};
+
+float sensor = 0;
+
+void onCommand() {}
+void onBool(bool) {}
+void onConstBool(const bool) {}
+void onInt(const int) {}
+void onFloat(const float) {}
+void onIndex(const uint8_t) {}
+void onAlarm(int, int, const uint8_t) {}
+void onInput(char*) {}
+
+/**
+ * @brief A menu with every item type, a sub menu, an empty screen and a
+ * screen without selectable items.
+ */
+struct FuzzMenu {
+    CheckedDisplay display;
+    SimulatedClock clock;
+    CharacterDisplayRenderer renderer;
+    LcdMenu menu;
+    MenuScreen* emptyScreen;
+    MenuScreen* labelScreen;
+    MenuScreen* settingsScreen;
+    MenuScreen* mainScreen;
+
+    FuzzMenu(uint8_t cols, uint8_t rows)
+        : display(cols, rows), renderer(&display, cols, rows), menu(renderer) {
+        emptyScreen = new MenuScreen(std::vector<MenuItem*>());
+        labelScreen = new MenuScreen({ITEM_LABEL("Only"), ITEM_LABEL("Labels")});
+        settingsScreen = new MenuScreen({
+            ITEM_BACK(),
+            ITEM_BASIC("Settings item"),
+            ITEM_SUBMENU("Empty", emptyScreen),
+        });
+        mainScreen = new MenuScreen({
+            ITEM_LABEL("Fuzz menu"),
+            ITEM_BASIC("Basic"),
+            ITEM_COMMAND("Command", onCommand),
+            ITEM_TOGGLE("Toggle", onBool),
+            ITEM_INPUT("Input", onInput),
+            ITEM_INPUT_CHARSET("Charset", "ABC012", onInput),
+            ITEM_VALUE("Sensor", sensor, "%.1f"),
+            ITEM_RANGE<int>("Int", 10, 5, 0, 100, onInt, "%d"),
+            ITEM_RANGE<float>("Float", 1.0f, 0.1f, 0.0f, 2.0f, onFloat, "%.1f", 0, true),
+            ITEM_LIST<const char*>("Day", days, onIndex, 0, "%s", 0, true),
+            ITEM_BOOL("Bool", true, "On", "Off", onConstBool),
+            ITEM_WIDGET(
+                "Alarm",
+                onAlarm,
+                WIDGET_RANGE(7, 1, 0, 23, "%02d", 0, true),
+                WIDGET_RANGE(30, 1, 0, 59, ":%02d", 0, true),
+                WIDGET_LIST(days, 0, " %s", 0, true)),
+            ITEM_SUBMENU("Settings", settingsScreen),
+            ITEM_SUBMENU("Empty", emptyScreen),
+            ITEM_SUBMENU("Labels", labelScreen),
+            ITEM_BACK(),
+        });
+        renderer.setClock(&clock);
+        renderer.begin();
+        menu.setScreen(mainScreen);
+    }
+
+    ~FuzzMenu() {
+        for (MenuScreen* screen : {mainScreen, settingsScreen, labelScreen, emptyScreen}) {
+            for (uint8_t i = 0; i < screen->size(); i++) {
+                delete screen->getItemAt(i);
+            }
+            delete screen;
+        }
+    }
+};
+
+const char* commandName(int command) {
+    switch (command) {
+        case POLL:
+            return "POLL";
+        case UP:
+            return "UP";
+        case DOWN:
+            return "DOWN";
+        case LEFT:
+            return "LEFT";
+        case RIGHT:
+            return "RIGHT";
+        case ENTER:
+            return "ENTER";
+        case BACK:
+            return "BACK";
+        case BACKSPACE:
+            return "BACKSPACE";
+        case CLEAR:
+            return "CLEAR";
+        default:
+            return nullptr;
+    }
+}
+
+void printCommand(FILE* out, int command) {
+    const char* name = commandName(command);
+    if (name != nullptr) {
+        fputs(name, out);
+    } else if (command > ' ' && command < 0x7F && command != '#') {
+        fputc(command, out);
+    } else {
+        fprintf(out, "0x%02X", command);
+    }
+}
+
+/**
+ * @brief Check the invariants of the menu after a command.
+ * @return a description of the broken invariant or `nullptr`
+ */
+const char* checkInvariants(FuzzMenu& fuzz) {
+    MenuScreen* screen = fuzz.menu.getScreen();
+    if (screen == nullptr) return "no current screen";
+    uint8_t size = screen->size();
+    uint8_t cursor = screen->getCursor();
+    uint8_t view = screen->getView();
+    uint8_t rows = fuzz.renderer.getMaxRows();
+    if (size == 0) {
+        if (cursor != 0 || view != 0) return "cursor or view moved on an empty screen";
+        if (fuzz.menu.isEditing()) return "editing on an empty screen";
+    } else {
+        if (cursor >= size) return "cursor past the last item";
+        if (cursor < view || cursor >= view + rows) return "cursor outside [view, view + maxRows)";
+        if (view > 0 && view + rows > size) return "view past the last item";
+        bool anySelectable = false;
+        for (uint8_t i = 0; i < size; i++) anySelectable |= screen->getItemAt(i)->isSelectable();
+        if (anySelectable && !screen->getItemAt(cursor)->isSelectable()) return "cursor on an unselectable item";
+    }
+    if (fuzz.display.outOfBounds > 0) return "display cursor moved outside the display";
+    return nullptr;
+}
+
+/**
+ * @brief Slowest command of one type over all streams.
+ */
+struct Slowest {
+    unsigned long count = 0;
+    double maxNs = 0;
+    const char* item = nullptr;
+    const char* screen = nullptr;
+    std::string stream;
+    size_t index = 0;
+};
+
+struct Report {
+    unsigned long streams = 0;
+    unsigned long commands = 0;
+    Slowest slowest[LatencyProbe::COMMAND_COUNT];
+};
+
+const char* screenName(FuzzMenu& fuzz, MenuScreen* screen) {
+    if (screen == fuzz.mainScreen) return "main";
+    if (screen == fuzz.settingsScreen) return "settings";
+    if (screen == fuzz.emptyScreen) return "empty";
+    return "labels";
+}
+
+/**
+ * @brief Where to write the first failing stream, `nullptr` to only print its end.
+ */
+const char* savePath = nullptr;
+
+void writeCommands(FILE* out, const Commands& commands, size_t from, size_t to) {
+    for (size_t i = from; i <= to; i++) {
+        printCommand(out, commands[i]);
+        fputc(i == to || (i - from) % 16 == 15 ? '\n' : ' ', out);
+    }
+}
+
+void printFailure(const std::string& stream, const Commands& commands, size_t index, const char* message) {
+    fprintf(stderr, "%s: command %zu: %s\n# replay:\n", stream.c_str(), index, message);
+    size_t from = index < 31 ? 0 : index - 31;
+    if (from > 0) fprintf(stderr, "# (%zu earlier commands omitted)\n", from);
+    writeCommands(stderr, commands, from, index);
+    FILE* out = savePath != nullptr ? fopen(savePath, "w") : nullptr;
+    if (out != nullptr) {
+        fprintf(out, "# %s: %s\n", stream.c_str(), message);
+        writeCommands(out, commands, 0, index);
+        fclose(out);
+        savePath = nullptr;
+    }
+}
+
+/**
+ * @brief Run one stream on a fresh menu.
+ * @return false if an invariant broke or the menu leaked
+ */
+bool runStream(const std::string& stream, const Commands& commands, uint8_t cols, uint8_t rows, Report& report) {
+    // Filled without allocating so the heap is only touched by the menu
+    Slowest slowestInStream[LatencyProbe::COMMAND_COUNT];
+    AllocationStats heapBefore = allocationStats();
+    {
+        FuzzMenu fuzz(cols, rows);
+        for (size_t i = 0; i < commands.size(); i++) {
+            int command = commands[i];
+            if (command == POLL) {
+                sensor += 0.5f;
+                fuzz.clock.advance(1000);
+                fuzz.menu.poll(1000);
+            } else {
+                MenuScreen* screen = fuzz.menu.getScreen();
+                const char* item = screen->size() > 0 ? screen->getItemAt(screen->getCursor())->getText() : "";
+                auto start = std::chrono::steady_clock::now();
+                fuzz.menu.process(static_cast<unsigned char>(command));
+                auto end = std::chrono::steady_clock::now();
+                double ns = std::chrono::duration<double, std::nano>(end - start).count();
+                Slowest& slowest = slowestInStream[LatencyProbe::classify(static_cast<unsigned char>(command))];
+                slowest.count++;
+                if (ns > slowest.maxNs) {
+                    slowest.maxNs = ns;
+                    slowest.item = item;
+                    slowest.screen = screenName(fuzz, screen);
+                    slowest.index = i;
+                }
+            }
+            const char* broken = checkInvariants(fuzz);
+            if (broken != nullptr) {
+                printFailure(stream, commands, i, broken);
+                return false;
+            }
+        }
+    }
+    AllocationStats heapAfter = allocationStats();
+    report.streams++;
+    report.commands += commands.size();
+    if (heapAfter.liveBytes != heapBefore.liveBytes) {
+        fprintf(stderr, "%s: %ld bytes leaked\n", stream.c_str(), static_cast<long>(heapAfter.liveBytes - heapBefore.liveBytes));
+        return false;
+    }
+    for (uint8_t c = 0; c < LatencyProbe::COMMAND_COUNT; c++) {
+        Slowest& slowest = report.slowest[c];
+        slowest.count += slowestInStream[c].count;
+        if (slowestInStream[c].maxNs > slowest.maxNs) {
+            unsigned long count = slowest.count;
+            slowest = slowestInStream[c];
+            slowest.count = count;
+            slowest.stream = stream;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief xorshift32, the same seed gives the same stream on every platform.
+ */
+uint32_t nextRandom(uint32_t& state) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+Commands randomStream(uint32_t seed, unsigned long length) {
+    // Navigation and editing dominate, like on a real keypad
+    static const int keypad[] = {UP, UP, DOWN, DOWN, DOWN, ENTER, ENTER, BACK, LEFT, RIGHT, BACKSPACE, CLEAR};
+    const size_t keys = sizeof(keypad) / sizeof(keypad[0]);
+    uint32_t state = seed * 2654435761u + 1;
+    Commands commands;
+    for (unsigned long i = 0; i < length; i++) {
+        uint32_t r = nextRandom(state);
+        if (i % 16 == 15) {
+            commands.push_back(POLL);
+        } else if (r % 32 == 0) {
+            commands.push_back((r >> 8) & 0xFF);
+        } else if (r % 8 == 0) {
+            commands.push_back(' ' + (r >> 8) % 95);
+        } else {
+            commands.push_back(keypad[(r >> 8) % keys]);
+        }
+    }
+    return commands;
+}
+
+bool parseToken(const std::string& token, int& command) {
+    static const int named[] = {POLL, UP, DOWN, LEFT, RIGHT, ENTER, BACK, BACKSPACE, CLEAR};
+    for (int c : named) {
+        if (token == commandName(c)) {
+            command = c;
+            return true;
+        }
+    }
+    if (token.size() == 1) {
+        command = static_cast<unsigned char>(token[0]);
+        return true;
+    }
+    if (token.size() == 4 && token[0] == '0' && token[1] == 'x') {
+        char* end;
+        command = static_cast<int>(strtol(token.c_str() + 2, &end, 16));
+        return *end == '\0';
+    }
+    return false;
+}
+
+bool readStream(const char* path, Commands& commands) {
+    FILE* in = fopen(path, "r");
+    if (in == nullptr) {
+        perror(path);
+        return false;
+    }
+    std::string token;
+    bool comment = false;
+    bool ok = true;
+    for (int c = fgetc(in);; c = fgetc(in)) {
+        if (c == '#' && token.empty()) comment = true;
+        if (c == EOF || c == '\n' || (!comment && (c == ' ' || c == '\t' || c == '\r'))) {
+            // `+Nms` delays printed by `InputRecording::printTo` are skipped
+            if (!comment && !token.empty() && !(token.size() > 1 && token[0] == '+')) {
+                size_t star = token.find('*', 1);
+                unsigned long repeat = star == std::string::npos ? 1 : strtoul(token.c_str() + star + 1, nullptr, 10);
+                int command;
+                if (!parseToken(token.substr(0, star), command)) {
+                    fprintf(stderr, "%s: unknown command '%s'\n", path, token.c_str());
+                    ok = false;
+                }
+                commands.insert(commands.end(), repeat, command);
+            }
+            token.clear();
+            if (c == '\n') comment = false;
+            if (c == EOF) break;
+        } else if (!comment) {
+            token += static_cast<char>(c);
+        }
+    }
+    fclose(in);
+    return ok;
+}
+
+void writeJson(FILE* out, const Report& report) {
+    static const char* names[LatencyProbe::COMMAND_COUNT] = {"UP", "DOWN", "LEFT", "RIGHT", "ENTER", "BACK", "PRINTABLE", "OTHER"};
+    fprintf(out, "{\n  \"fuzz\": \"lcdmenu\",\n  \"version\": \"%s\",\n", LCDMENU_VERSION);
+    fprintf(out, "  \"streams\": %lu,\n  \"commands\": %lu,\n  \"slowest\": [", report.streams, report.commands);
+    bool first = true;
+    for (uint8_t c = 0; c < LatencyProbe::COMMAND_COUNT; c++) {
+        const Slowest& slowest = report.slowest[c];
+        if (slowest.count == 0) continue;
+        fprintf(out, "%s\n    {\n      \"command\": \"%s\",\n", first ? "" : ",", names[c]);
+        fprintf(out, "      \"count\": %lu,\n", slowest.count);
+        fprintf(out, "      \"max_ns\": %.1f,\n", slowest.maxNs);
+        fprintf(out, "      \"screen\": \"%s\",\n", slowest.screen);
+        fprintf(out, "      \"item\": \"%s\",\n", slowest.item);
+        fprintf(out, "      \"stream\": \"%s\",\n", slowest.stream.c_str());
+        fprintf(out, "      \"index\": %zu\n    }", slowest.index);
+        first = false;
+    }
+    fprintf(out, "\n  ]\n}\n");
+}
+
+}  // namespace
+
+#ifdef LCDMENU_LIBFUZZER
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    Report report;
+    Commands commands(data, data + size);
+    if (!runStream("libfuzzer", commands, 16, 2, report)) abort();
+    return 0;
+}
+
+#else
+
+int main(int argc, char** argv) {
+    unsigned long firstSeed = 0;
+    unsigned long seeds = 100;
+    unsigned long length = 5000;
+    const char* output = nullptr;
+    std::vector<const char*> replays;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--seeds") == 0 && i + 1 < argc) {
+            seeds = strtoul(argv[++i], nullptr, 10);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            firstSeed = strtoul(argv[++i], nullptr, 10);
+            seeds = 1;
+        } else if (strcmp(argv[i], "--commands") == 0 && i + 1 < argc) {
+            length = strtoul(argv[++i], nullptr, 10);
+        } else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            replays.push_back(argv[++i]);
+        } else if (strcmp(argv[i], "--save") == 0 && i + 1 < argc) {
+            savePath = argv[++i];
+        } else if (strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+            output = argv[++i];
+        } else {
+            fprintf(stderr,
+                    "Usage: %s [--seeds N | --seed S] [--commands N] [--replay FILE]... [--save FILE] [--output FILE]\n",
+                    argv[0]);
+            return 2;
+        }
+    }
+
+    Report report;
+    bool ok = true;
+    for (const char* path : replays) {
+        Commands commands;
+        ok = readStream(path, commands) && ok;
+        // Recorded streams run on both display sizes
+        ok = runStream(std::string(path) + " (16x2)", commands, 16, 2, report) && ok;
+        ok = runStream(std::string(path) + " (20x4)", commands, 20, 4, report) && ok;
+    }
+    for (unsigned long seed = firstSeed; seed < firstSeed + seeds; seed++) {
+        std::string name = "seed " + std::to_string(seed);
+        uint8_t rows = seed % 2 == 0 ? 2 : 4;
+        ok = runStream(name, randomStream(seed, length), rows == 2 ? 16 : 20, rows, report) && ok;
+    }
+
+    FILE* out = output ? fopen(output, "w") : stdout;
+    if (out == nullptr) {
+        perror(output);
+        return 1;
+    }
+    writeJson(out, report);
+    if (out != stdout) fclose(out);
+    return ok ? 0 : 1;
+}
+
+#endif
@@ -0,0 +1,272 @@
+/*
+  LcdMenu native benchmark.
+
+  Runs parameterised scenarios against the real library sources on the host
+  and prints one JSON document with ns/op, heap allocations per op and the
+  bytes the menu sent to a virtual display per op.
+
+  Usage: lcdmenu_bench [--iterations N] [--filter NAME] [--output FILE]
+*/
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../test/support/AllocationCounter.h"
+#include "support/BenchDisplay.h"
+
+#include <ItemInput.h>
+#include <ItemList.h>
+#include <ItemRange.h>
+#include <ItemValue.h>
+#include <ItemWidget.h>
+#include <LcdMenu.h>
+#include <MenuScreen.h>
+#include <renderer/CharacterDisplayRenderer.h>
+#include <widget/WidgetList.h>
+#include <widget/WidgetRange.h>
+
+#ifndef LCDMENU_VERSION
+#define LCDMENU_VERSION "unknown"
+#endif
+
+namespace {
+
+typedef std::vector<std::pair<std::string, long>> Params;
+
+struct Result {
+    std::string name;
+    Params params;
+    unsigned long iterations;
+    double nsPerOp;
+    double allocationsPerOp;
+    double allocatedBytesPerOp;
+    double dataBytesPerOp;
+    double setCursorPerOp;
+    double clearsPerOp;
+    double busBytesPerOp;
+};
+
+/**
+ * @brief One menu wired to a counting display.
+ */
+struct Fixture {
+    BenchDisplay display;
+    CharacterDisplayRenderer renderer;
+    LcdMenu menu;
+    MenuScreen* screen;
+
+    Fixture(const std::vector<MenuItem*>& items, uint8_t cols, uint8_t rows)
+        : renderer(&display, cols, rows), menu(renderer), screen(new MenuScreen(items)) {
+        renderer.begin();
+        menu.setScreen(screen);
+    }
+
+    ~Fixture() {
+        for (uint8_t i = 0; i < screen->size(); i++) {
+            delete screen->getItemAt(i);
+        }
+        delete screen;
+    }
+};
+
+template <typename Op>
+Result measure(const char* name, const Params& params, Fixture& fixture, unsigned long iterations, Op op) {
+    unsigned long warmup = iterations / 10 < 100 ? iterations / 10 : 100;
+    for (unsigned long i = 0; i < warmup; i++) op(i);
+
+    BenchDisplay before = fixture.display;
+    AllocationStats heapBefore = allocationStats();
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned long i = 0; i < iterations; i++) op(i);
+    auto end = std::chrono::steady_clock::now();
+    AllocationStats heapAfter = allocationStats();
+    const BenchDisplay& after = fixture.display;
+
+    double n = static_cast<double>(iterations);
+    Result result;
+    result.name = name;
+    result.params = params;
+    result.iterations = iterations;
+    result.nsPerOp = std::chrono::duration<double, std::nano>(end - start).count() / n;
+    result.allocationsPerOp = (heapAfter.allocations - heapBefore.allocations) / n;
+    result.allocatedBytesPerOp = (heapAfter.bytesAllocated - heapBefore.bytesAllocated) / n;
+    result.dataBytesPerOp = (after.dataBytes - before.dataBytes) / n;
+    result.setCursorPerOp = (after.setCursorCalls - before.setCursorCalls) / n;
+    result.clearsPerOp = (after.clearCalls - before.clearCalls) / n;
+    result.busBytesPerOp = (after.busBytes() - before.busBytes()) / n;
+    return result;
+}
+
+const std::vector<const char*> days = {"Mon", "Tue", "Wed", "Thu", "Fri", "Sat", "Sun"};
+
+void onInt(const int) {}
+void onFloat(const float) {}
+void onIndex(const uint8_t) {}
+void onFreq(int, int, const uint8_t) {}
+void onInput(char*) {}
+
+/**
+ * @brief Move the cursor down through N items and back up again.
+ */
+Result navigate(unsigned long iterations, long count) {
+    std::vector<MenuItem*> items;
+    for (long i = 0; i < count; i++) items.push_back(ITEM_BASIC("Navigation item"));
+    Fixture fixture(items, 16, 2);
+    long span = count - 1;
+    return measure("navigate", {{"items", count}, {"cols", 16}, {"rows", 2}}, fixture, iterations, [&](unsigned long i) {
+        fixture.menu.process((i / span) % 2 == 0 ? DOWN : UP);
+    });
+}
+
+/**
+ * @brief Step a range item up and down while in edit mode.
+ */
+Result editIntRange(unsigned long iterations) {
+    Fixture fixture({ITEM_RANGE<int>("Price", 10, 5, 0, 1000, onInt, "%d"), ITEM_BASIC("Other")}, 16, 2);
+    fixture.menu.process(ENTER);
+    return measure("edit_range_int", {{"cols", 16}, {"rows", 2}}, fixture, iterations, [&](unsigned long i) {
+        fixture.menu.process(i % 2 == 0 ? UP : DOWN);
+    });
+}
+
+Result editFloatRange(unsigned long iterations) {
+    Fixture fixture({ITEM_RANGE<float>("Quantity", 1.0f, 0.1f, 0.1f, 100.0f, onFloat, "%.1f"), ITEM_BASIC("Other")}, 16, 2);
+    fixture.menu.process(ENTER);
+    return measure("edit_range_float", {{"cols", 16}, {"rows", 2}}, fixture, iterations, [&](unsigned long i) {
+        fixture.menu.process(i % 2 == 0 ? UP : DOWN);
+    });
+}
+
+/**
+ * @brief Cycle through a list item while in edit mode.
+ */
+Result editList(unsigned long iterations) {
+    Fixture fixture({ITEM_LIST<const char*>("Day", days, onIndex, 0, "%s", 0, true), ITEM_BASIC("Other")}, 16, 2);
+    fixture.menu.process(ENTER);
+    return measure("edit_list", {{"values", static_cast<long>(days.size())}, {"cols", 16}, {"rows", 2}}, fixture, iterations, [&](unsigned long) {
+        fixture.menu.process(UP);
+    });
+}
+
+/**
+ * @brief Redraw a screen of multi-widget items (one snprintf per widget).
+ */
+Result drawWidgets(unsigned long iterations) {
+    Fixture fixture(
+        {ITEM_WIDGET(
+             "Freq",
+             onFreq,
+             WIDGET_RANGE(0, 1, 0, 23, "%02d", 0, false),
+             WIDGET_RANGE(0, 1, 0, 59, ":%02d", 0, false),
+             WIDGET_LIST(days, 0, " on %s", 0, true)),
+         ITEM_WIDGET(
+             "Quantity",
+             onFloat,
+             WIDGET_RANGE(1.0f, 0.1f, 0.1f, 100.0f, "%.1f", 0))},
+        16,
+        2);
+    return measure("draw_widgets", {{"widgets", 4}, {"cols", 16}, {"rows", 2}}, fixture, iterations, [&](unsigned long) {
+        fixture.menu.refresh();
+    });
+}
+
+/**
+ * @brief Type printable characters into an input item, clearing it periodically.
+ */
+Result typeInput(unsigned long iterations) {
+    const long clearEvery = 16;
+    char value[] = "";
+    Fixture fixture({new ItemInput("Name", value, onInput), ITEM_BASIC("Other")}, 16, 2);
+    fixture.menu.process(ENTER);
+    return measure("type_input", {{"clear_every", clearEvery}, {"cols", 16}, {"rows", 2}}, fixture, iterations, [&](unsigned long i) {
+        fixture.menu.process(i % clearEvery == clearEvery - 1 ? CLEAR : 'a' + i % 26);
+    });
+}
+
+/**
+ * @brief Poll a dashboard of value items whose bound variables change every tick.
+ */
+Result pollDashboard(unsigned long iterations, long count) {
+    const uint16_t interval = 100;
+    std::vector<float> floats(count);
+    std::vector<MenuItem*> items;
+    for (long i = 0; i < count; i++) items.push_back(ITEM_VALUE("Sensor", floats[i], "%.1f"));
+    Fixture fixture(items, 20, 4);
+    return measure("poll_dashboard", {{"items", count}, {"interval_ms", interval}, {"cols", 20}, {"rows", 4}}, fixture, iterations, [&](unsigned long) {
+        for (float& f : floats) f += 0.1f;
+        shim::advanceMillis(interval);
+        fixture.menu.poll(interval);
+    });
+}
+
+void writeJson(FILE* out, const std::vector<Result>& results) {
+    fprintf(out, "{\n  \"benchmark\": \"lcdmenu\",\n  \"version\": \"%s\",\n  \"results\": [", LCDMENU_VERSION);
+    for (size_t r = 0; r < results.size(); r++) {
+        const Result& result = results[r];
+        fprintf(out, "%s\n    {\n      \"name\": \"%s\",\n      \"params\": {", r ? "," : "", result.name.c_str());
+        for (size_t p = 0; p < result.params.size(); p++) {
+            fprintf(out, "%s\"%s\": %ld", p ? ", " : "", result.params[p].first.c_str(), result.params[p].second);
+        }
+        fprintf(out, "},\n");
+        fprintf(out, "      \"iterations\": %lu,\n", result.iterations);
+        fprintf(out, "      \"ns_per_op\": %.1f,\n", result.nsPerOp);
+        fprintf(out, "      \"allocations_per_op\": %.3f,\n", result.allocationsPerOp);
+        fprintf(out, "      \"allocated_bytes_per_op\": %.3f,\n", result.allocatedBytesPerOp);
+        fprintf(out, "      \"display_data_bytes_per_op\": %.3f,\n", result.dataBytesPerOp);
+        fprintf(out, "      \"display_set_cursor_per_op\": %.3f,\n", result.setCursorPerOp);
+        fprintf(out, "      \"display_clears_per_op\": %.3f,\n", result.clearsPerOp);
+        fprintf(out, "      \"display_bus_bytes_per_op\": %.3f\n", result.busBytesPerOp);
+        fprintf(out, "    }");
+    }
+    fprintf(out, "\n  ]\n}\n");
+}
+
+bool selected(const char* filter, const char* name) {
+    return filter == nullptr || strstr(name, filter) != nullptr;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    unsigned long iterations = 20000;
+    const char* filter = nullptr;
+    const char* output = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            iterations = strtoul(argv[++i], nullptr, 10);
+        } else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+            output = argv[++i];
+        } else {
+            fprintf(stderr, "Usage: %s [--iterations N] [--filter NAME] [--output FILE]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (iterations == 0) iterations = 1;
+
+    std::vector<Result> results;
+    for (long count : {8L, 64L}) {
+        if (selected(filter, "navigate")) results.push_back(navigate(iterations, count));
+    }
+    if (selected(filter, "edit_range_int")) results.push_back(editIntRange(iterations));
+    if (selected(filter, "edit_range_float")) results.push_back(editFloatRange(iterations));
+    if (selected(filter, "edit_list")) results.push_back(editList(iterations));
+    if (selected(filter, "draw_widgets")) results.push_back(drawWidgets(iterations));
+    if (selected(filter, "type_input")) results.push_back(typeInput(iterations));
+    for (long count : {4L, 16L}) {
+        if (selected(filter, "poll_dashboard")) results.push_back(pollDashboard(iterations, count));
+    }
+
+    FILE* out = output ? fopen(output, "w") : stdout;
+    if (out == nullptr) {
+        perror(output);
+        return 1;
+    }
+    writeJson(out, results);
+    if (out != stdout) fclose(out);
+    return 0;
+}
@@ -0,0 +1,13 @@
+#include "Arduino.h"
+
+static unsigned long virtualMicros = 0;
+
+unsigned long millis() { return virtualMicros / 1000; }
+
+unsigned long micros() { return virtualMicros; }
+
+void delay(unsigned long ms) { shim::advanceMillis(ms); }
+
+void shim::setMicros(unsigned long value) { virtualMicros = value; }
+
+void shim::advanceMillis(unsigned long ms) { virtualMicros += ms * 1000; }
@@ -0,0 +1,48 @@
+/*
+  Arduino.h - Minimal Arduino core shim for native (host) builds of LcdMenu.
+
+  Only the subset of the Arduino API that the library sources touch is
+  provided. Time is virtual: `millis()` and `micros()` return a counter that
+  the host program advances explicitly, so scenarios that depend on polling
+  intervals or timeouts run without waiting in real time.
+*/
+#pragma once
+
+#include <ctype.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper*>(string_literal))
+
+// Flash and RAM share one address space on the host
+#define PROGMEM
+#define strlen_P strlen
+#define strncpy_P strncpy
+#define pgm_read_byte(address) (*reinterpret_cast<const uint8_t*>(address))
+
+#ifndef constrain
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#endif
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+
+namespace shim {
+/**
+ * @brief Set the virtual clock returned by `micros()` / `millis()`.
+ */
+void setMicros(unsigned long value);
+/**
+ * @brief Advance the virtual clock by the given number of milliseconds.
+ */
+void advanceMillis(unsigned long ms);
+}  // namespace shim
+
+#include "Stream.h"
@@ -0,0 +1,53 @@
+/*
+  Stream.h - Minimal Print/Stream shim for native (host) builds of LcdMenu.
+*/
+#pragma once
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+class __FlashStringHelper;
+
+class Print {
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t byte) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size) {
+        size_t n = 0;
+        while (size--) n += write(*buffer++);
+        return n;
+    }
+    virtual int availableForWrite() { return 0x7FFF; }
+    size_t print(const char* text) { return write(reinterpret_cast<const uint8_t*>(text), strlen(text)); }
+    size_t print(char c) { return write(static_cast<uint8_t>(c)); }
+    size_t print(const __FlashStringHelper* text) { return print(reinterpret_cast<const char*>(text)); }
+    size_t print(unsigned long n) {
+        char buf[21];
+        snprintf(buf, sizeof(buf), "%lu", n);
+        return print(buf);
+    }
+    size_t print(long n) {
+        char buf[21];
+        snprintf(buf, sizeof(buf), "%ld", n);
+        return print(buf);
+    }
+    size_t print(unsigned int n) { return print(static_cast<unsigned long>(n)); }
+    size_t print(int n) { return print(static_cast<long>(n)); }
+    size_t print(double n) {
+        char buf[32];
+        snprintf(buf, sizeof(buf), "%.2f", n);
+        return print(buf);
+    }
+    size_t println() { return print("\r\n"); }
+    template <typename T>
+    size_t println(T value) { return print(value) + println(); }
+};
+
+class Stream : public Print {
+  public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+};
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <display/CharacterDisplayInterface.h>
+
+/**
+ * @brief Virtual character display that renders nothing and counts bus traffic.
+ *
+ * Each call maps to what an HD44780 adapter would put on the bus: one command
+ * per `setCursor`/`clear`/`show`/`hide`, one data byte per drawn character and
+ * a command plus eight data bytes per `createChar`.
+ */
+class BenchDisplay : public CharacterDisplayInterface {
+  public:
+    unsigned long dataBytes = 0;
+    unsigned long setCursorCalls = 0;
+    unsigned long clearCalls = 0;
+    unsigned long controlCalls = 0;
+
+    void begin() override {}
+    void clear() override { clearCalls++; }
+    void show() override { controlCalls++; }
+    void hide() override { controlCalls++; }
+    void draw(uint8_t) override { dataBytes++; }
+    void draw(const char* text) override { dataBytes += strlen(text); }
+    void setCursor(uint8_t, uint8_t) override { setCursorCalls++; }
+    void setBacklight(bool) override { controlCalls++; }
+    void createChar(uint8_t, uint8_t*) override {
+        controlCalls++;
+        dataBytes += 8;
+    }
+    void drawBlinker() override { controlCalls++; }
+    void clearBlinker() override { controlCalls++; }
+
+    /**
+     * @brief Total bytes that would cross the bus (commands and data).
+     */
+    unsigned long busBytes() const { return dataBytes + setCursorCalls + clearCalls + controlCalls; }
+};
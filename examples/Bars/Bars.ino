@@ -0,0 +1,65 @@
+#include <ItemBar.h>
+#include <ItemCommand.h>
+#include <LcdMenu.h>
+#include <MenuScreen.h>
+#include <display/LiquidCrystal_I2CAdapter.h>
+#include <input/KeyboardAdapter.h>
+#include <renderer/CharacterDisplayRenderer.h>
+
+#define LCD_ROWS 2
+#define LCD_COLS 16
+
+// A potentiometer shown as a bar, and a spinner while a job runs.
+// Custom characters: 0 and 1 are the arrows, 2 the spinner, 3 to 6 the bars.
+
+#define POT_PIN A0
+
+const uint8_t spinner[4][8] = {
+    {0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00},
+    {0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x00}};
+
+int pot = 0;
+unsigned long jobStartedAt = 0;
+bool jobRunning = false;
+
+void startJob();
+
+// clang-format off
+MENU_SCREEN(mainScreen, mainItems,
+    ITEM_BAR("Pot", pot, 0, 1023, 10),
+    ITEM_COMMAND("Sync \x02", startJob),
+    ITEM_BASIC("Settings"));
+// clang-format on
+
+LiquidCrystal_I2C lcd(0x27, LCD_COLS, LCD_ROWS);
+CharacterDisplayRenderer renderer(new LiquidCrystal_I2CAdapter(&lcd), LCD_COLS, LCD_ROWS);
+LcdMenu menu(renderer);
+KeyboardAdapter keyboard(&menu, &Serial);
+
+void startJob() {
+    jobStartedAt = millis();
+    jobRunning = true;
+    renderer.setAnimation(2, spinner, 4, 150);
+}
+
+void setup() {
+    Serial.begin(9600);
+    renderer.begin();
+    renderer.setBarGlyphs(3);
+    // Keep the first frame of the spinner until a job runs
+    renderer.setAnimation(2, spinner, 4, 150);
+    renderer.stopAnimation();
+    menu.setScreen(mainScreen);
+}
+
+void loop() {
+    keyboard.observe();
+    pot = analogRead(POT_PIN);
+    if (jobRunning && millis() - jobStartedAt > 5000) {
+        jobRunning = false;
+        renderer.stopAnimation();
+    }
+    menu.poll(200);
+}
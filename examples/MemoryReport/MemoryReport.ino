@@ -0,0 +1,65 @@
+#include <ItemCommand.h>
+#include <ItemInput.h>
+#include <ItemSubMenu.h>
+#include <ItemWidget.h>
+#include <LcdMenu.h>
+#include <MenuScreen.h>
+#include <diagnostics/MemoryReport.h>
+#include <display/LiquidCrystal_I2CAdapter.h>
+#include <input/KeyboardAdapter.h>
+#include <renderer/CharacterDisplayRenderer.h>
+#include <widget/WidgetList.h>
+#include <widget/WidgetRange.h>
+
+#define LCD_ROWS 2
+#define LCD_COLS 16
+#define LCD_ADDR 0x27
+
+void printMemoryReport();
+
+std::vector<const char*> days = {"Mon", "Tue", "Wed", "Thu", "Fri", "Sat", "Sun"};
+char name[] = "Sensor";
+
+extern MenuScreen* settingsScreen;
+
+// clang-format off
+MENU_SCREEN(mainScreen, mainItems,
+    ITEM_SUBMENU("Settings", settingsScreen),
+    ITEM_COMMAND("Memory report", printMemoryReport),
+    ITEM_BASIC("Blink SOS"));
+
+MENU_SCREEN(settingsScreen, settingsItems,
+    ITEM_INPUT("Name", name, [](char* value) { Serial.println(value); }),
+    ITEM_WIDGET(
+        "Alarm",
+        [](int hour, int minute, const uint8_t day) { Serial.println(days[day]); },
+        WIDGET_RANGE(7, 1, 0, 23, "%02d", 0, true),
+        WIDGET_RANGE(30, 1, 0, 59, ":%02d", 0, true),
+        WIDGET_LIST(days, 0, " %s", 0, true)));
+// clang-format on
+
+LiquidCrystal_I2C lcd(LCD_ADDR, LCD_COLS, LCD_ROWS);
+LiquidCrystal_I2CAdapter lcdAdapter(&lcd);
+CharacterDisplayRenderer renderer(&lcdAdapter, LCD_COLS, LCD_ROWS);
+LcdMenu menu(renderer);
+KeyboardAdapter keyboard(&menu, &Serial);
+
+void printMemoryReport() {
+    MemoryReport report;
+    // The menu, the renderer and the screen on display
+    menu.memoryReport(report);
+    // Screens that are not on display
+    settingsScreen->report(report);
+    report.printTo(Serial);
+}
+
+void setup() {
+    Serial.begin(9600);
+    renderer.begin();
+    menu.setScreen(mainScreen);
+    printMemoryReport();
+}
+
+void loop() {
+    keyboard.observe();
+}
@@ -0,0 +1,60 @@
+#include <Button.h>
+#include <ItemRange.h>
+#include <ItemValue.h>
+#include <LcdMenu.h>
+#include <MenuScreen.h>
+#include <display/LiquidCrystal_I2CAdapter.h>
+#include <input/ButtonAdapter.h>
+#include <input/KeyboardAdapter.h>
+#include <renderer/CharacterDisplayRenderer.h>
+
+// The same menu on two displays: an operator panel driven from the serial
+// monitor and a service panel driven by buttons. Each menu has its own cursor
+// and edit state, editing on one panel does not stop the other from polling.
+
+int pressure = 0;
+int setpoint = 50;
+
+// clang-format off
+MENU_SCREEN(mainScreen, mainItems,
+    ITEM_VALUE("Pressure", pressure, "%d"),
+    ITEM_RANGE_REF<int>("Setpoint", setpoint, 5, 0, 100, [](const Ref<int> value) { Serial.println(value.value); }, "%d"),
+    ITEM_BASIC("Start pump"),
+    ITEM_BASIC("Stop pump"));
+// clang-format on
+
+LiquidCrystal_I2C frontLcd(0x27, 20, 4);
+CharacterDisplayRenderer frontRenderer(new LiquidCrystal_I2CAdapter(&frontLcd), 20, 4);
+LcdMenu front(frontRenderer);
+KeyboardAdapter keyboard(&front, &Serial);
+
+LiquidCrystal_I2C backLcd(0x26, 16, 2);
+CharacterDisplayRenderer backRenderer(new LiquidCrystal_I2CAdapter(&backLcd), 16, 2);
+LcdMenu back(backRenderer);
+Button downBtn(5);
+ButtonAdapter downBtnA(&back, &downBtn, DOWN);
+Button enterBtn(6);
+ButtonAdapter enterBtnA(&back, &enterBtn, ENTER);
+Button backBtn(7);
+ButtonAdapter backBtnA(&back, &backBtn, BACK);
+
+void setup() {
+    Serial.begin(9600);
+    downBtn.begin();
+    enterBtn.begin();
+    backBtn.begin();
+    frontRenderer.begin();
+    backRenderer.begin();
+    front.setScreen(mainScreen);
+    back.setScreen(mainScreen);
+}
+
+void loop() {
+    keyboard.observe();
+    downBtnA.observe();
+    enterBtnA.observe();
+    backBtnA.observe();
+    pressure = analogRead(A0) / 10;
+    front.poll();
+    back.poll();
+}
@@ -7,6 +7,7 @@
 #include <ItemValue.h>
 #include <LcdMenu.h>
 #include <MenuScreen.h>
+#include <SharedValue.h>
 #include <display/LiquidCrystal_I2CAdapter.h>
 #include <input/KeyboardAdapter.h>
 #include <renderer/CharacterDisplayRenderer.h>
@@ -16,7 +17,8 @@
 #define LCD_ROWS 2
 #define LCD_COLS 16
 
-uint8_t temperature1, temperature2, temperature3;
+// Written by the measuring task while the menu draws them
+SharedValue<float> temperature1, temperature2, temperature3;
 bool relay1State, relay2State, relay3State;
 
 // Relay 1 Toggle
@@ -62,9 +64,9 @@ MENU_SCREEN(relayScreen, relayItems,
 // Sub Menu 2: Temperature Values
 // clang-format off
 MENU_SCREEN(tempScreen, tempItems, 
-    ITEM_VALUE("Temp1", temperature1, "%d C"), 
-    ITEM_VALUE("Temp2", temperature2, "%d C"),
-    ITEM_VALUE("Temp3", temperature3, "%d C"));
+    ITEM_VALUE("Temp1", temperature1, "%.1f C"), 
+    ITEM_VALUE("Temp2", temperature2, "%.1f C"),
+    ITEM_VALUE("Temp3", temperature3, "%.1f C"));
 // clang-format on
 
 // RTOS func. to measure temperature value
@@ -73,11 +75,11 @@ static void tempMeas(void* pvParameters) {
     for (;;) {
         //-------------------BEGIN: TEST WITH RANDOM------------------//
         // Update temperature1 only if relay1 is on
-        if (relay1State) temperature1 = random(1, 101);
+        if (relay1State) temperature1.store(random(10, 1001) / 10.0f);
         // Update temperature2 only if relay2 is on
-        if (relay2State) temperature2 = random(1, 101);
+        if (relay2State) temperature2.store(random(10, 1001) / 10.0f);
         // Update temperature3 only if relay3 is on
-        if (relay3State) temperature3 = random(1, 101);
+        if (relay3State) temperature3.store(random(10, 1001) / 10.0f);
         //-------------------END: TEST WITH RANDOM--------------------//
         vTaskDelay(2000 / portTICK_PERIOD_MS);  // wait for two seconds
     }
@@ -0,0 +1,94 @@
+#include <ItemList.h>
+#include <ItemRange.h>
+#include <LcdMenu.h>
+#include <MenuScreen.h>
+#include <display/LiquidCrystal_I2CAdapter.h>
+#include <input/InputRecorder.h>
+#include <input/KeyboardAdapter.h>
+#include <input/ReplayAdapter.h>
+#include <renderer/CharacterDisplayRenderer.h>
+
+#define LCD_ROWS 2
+#define LCD_COLS 16
+
+// Navigate with the keyboard (see the KeyboardAdapter example), everything
+// is recorded. Then send
+//   '!' to replay the recording at the pace it was typed,
+//   '?' to replay it as fast as possible and print the command rate,
+//   '=' to print the recording,
+//   '*' to start a new recording.
+
+std::vector<const char*> colors = {"Red", "Green", "Blue", "White"};
+
+// clang-format off
+MENU_SCREEN(mainScreen, mainItems,
+    ITEM_LIST("Color", colors, [](const uint8_t color) {}, 0, "%s", 0, true),
+    ITEM_RANGE<int>("Brightness", 50, 5, 0, 100, [](const int value) {}, "%d%%"),
+    ITEM_BASIC("Blink SOS"),
+    ITEM_BASIC("Blink random"));
+// clang-format on
+
+LiquidCrystal_I2C lcd(0x27, LCD_COLS, LCD_ROWS);
+CharacterDisplayRenderer renderer(new LiquidCrystal_I2CAdapter(&lcd), LCD_COLS, LCD_ROWS);
+LcdMenu menu(renderer);
+
+// 3 bytes per command
+uint8_t storage[3 * 100];
+InputRecording recording(storage, sizeof(storage));
+
+KeyboardAdapter keyboard(&menu, &Serial);
+InputRecorder recorder(&menu, &keyboard, &recording);
+ReplayAdapter replay(&menu, &recording);
+
+// Leave edit mode and go back to where the recording started
+void restart() {
+    if (menu.isEditing()) menu.process(BACK);
+    menu.setScreen(mainScreen);
+}
+
+void setup() {
+    Serial.begin(9600);
+    renderer.begin();
+    menu.setScreen(mainScreen);
+    recorder.start();
+}
+
+void loop() {
+    switch (Serial.peek()) {
+        case '!':
+            Serial.read();
+            recorder.stop();
+            restart();
+            replay.setMode(ReplayAdapter::REAL_TIME);
+            replay.play();
+            break;
+        case '?': {
+            Serial.read();
+            recorder.stop();
+            restart();
+            replay.play();
+            unsigned long us = replay.replayAll();
+            Serial.print(recording.size());
+            Serial.print(F(" commands in "));
+            Serial.print(us);
+            Serial.print(F("us, "));
+            Serial.print(us > 0 ? recording.size() * 1000000.0 / us : 0);
+            Serial.println(F(" commands/s"));
+            break;
+        }
+        case '=':
+            Serial.read();
+            recording.printTo(Serial);
+            break;
+        case '*':
+            Serial.read();
+            replay.stop();
+            recording.clear();
+            restart();
+            recorder.start();
+            break;
+    }
+    recorder.observe();
+    replay.observe();
+    renderer.updateTimer();
+}
@@ -0,0 +1,51 @@
+#include <ItemBool.h>
+#include <ItemList.h>
+#include <ItemRange.h>
+#include <ItemSubMenu.h>
+#include <LcdMenu.h>
+#include <MenuScreen.h>
+#include <display/LiquidCrystal_I2CAdapter.h>
+#include <input/RemoteControl.h>
+#include <renderer/CharacterDisplayRenderer.h>
+
+#define LCD_ROWS 2
+#define LCD_COLS 16
+
+// A test jig on the serial port reads and sets the values in batches,
+// for example this request sets "Brightness" to 80 and reads "Color":
+//   A5 0F  53 49 01 00 00 69 50 00 00 00  47 50 01 01 00  21
+// where 21 is the CRC-8 of the payload. See RemoteControl.h for the format.
+
+std::vector<const char*> colors = {"Red", "Green", "Blue", "White"};
+
+extern MenuScreen* settingsScreen;
+
+// clang-format off
+MENU_SCREEN(mainScreen, mainItems,
+    ITEM_SUBMENU("Settings", settingsScreen),
+    ITEM_BASIC("Blink SOS"));
+
+MENU_SCREEN(settingsScreen, settingsItems,
+    ITEM_RANGE<int>("Brightness", 50, 5, 0, 100, [](const int value) {}, "%d%%"),
+    ITEM_LIST("Color", colors, [](const uint8_t color) {}, 0, "%s", 0, true),
+    ITEM_BOOL("Backlight", true, "ON", "OFF", [](const bool enabled) {}));
+// clang-format on
+
+LiquidCrystal_I2C lcd(0x27, LCD_COLS, LCD_ROWS);
+CharacterDisplayRenderer renderer(new LiquidCrystal_I2CAdapter(&lcd), LCD_COLS, LCD_ROWS);
+LcdMenu menu(renderer);
+RemoteControl remote(&menu, &Serial);
+
+void setup() {
+    Serial.begin(115200);
+    renderer.begin();
+    menu.setScreen(mainScreen);
+    // Screen 1 by position, the brightness also by ID 1
+    remote.addScreen(settingsScreen);
+    remote.bind(1, settingsScreen->getItemAt(0));
+}
+
+void loop() {
+    remote.observe();
+    renderer.updateTimer();
+}
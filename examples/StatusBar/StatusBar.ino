@@ -0,0 +1,61 @@
+#include <LcdMenu.h>
+#include <MenuScreen.h>
+#include <StatusBar.h>
+#include <display/LiquidCrystal_I2CAdapter.h>
+#include <input/KeyboardAdapter.h>
+#include <renderer/CharacterDisplayRenderer.h>
+
+#define LCD_ROWS 4
+#define LCD_COLS 20
+
+// Row 0 shows the uptime and the state of an input pin,
+// the menu scrolls in rows 1 to 3.
+
+#define ALARM_PIN 2
+
+// clang-format off
+MENU_SCREEN(mainScreen, mainItems,
+    ITEM_BASIC("Start service"),
+    ITEM_BASIC("Connect to WiFi"),
+    ITEM_BASIC("Settings"),
+    ITEM_BASIC("Blink SOS"),
+    ITEM_BASIC("Blink random"));
+// clang-format on
+
+LiquidCrystal_I2C lcd(0x27, LCD_COLS, LCD_ROWS);
+CharacterDisplayRenderer renderer(new LiquidCrystal_I2CAdapter(&lcd), LCD_COLS, LCD_ROWS);
+LcdMenu menu(renderer);
+KeyboardAdapter keyboard(&menu, &Serial);
+StatusBar status(&menu, 0);
+
+bool alarm = false;
+int8_t alarmField;
+
+void drawUptime(char* buffer, uint8_t width) {
+    unsigned long seconds = millis() / 1000;
+    snprintf(buffer, width + 1, "%02lu:%02lu:%02lu", seconds / 3600 % 24, seconds / 60 % 60, seconds % 60);
+}
+
+void drawAlarm(char* buffer, uint8_t width) {
+    snprintf(buffer, width + 1, alarm ? "ALARM" : "");
+}
+
+void setup() {
+    Serial.begin(9600);
+    pinMode(ALARM_PIN, INPUT_PULLUP);
+    renderer.setViewport(1, LCD_ROWS - 1);
+    renderer.begin();
+    menu.setScreen(mainScreen);
+    status.addField(0, 8, drawUptime, 1000);
+    alarmField = status.addField(15, 5, drawAlarm, 0);
+}
+
+void loop() {
+    keyboard.observe();
+    bool pressed = digitalRead(ALARM_PIN) == LOW;
+    if (pressed != alarm) {
+        alarm = pressed;
+        status.markDirty(alarmField);
+    }
+    status.update();
+}
@@ -72,7 +72,7 @@ void loop() {
     menu.poll();
     unsigned long now = millis();
     if (now - last > 1000) {
-        if (!MenuItem::isEditing()) {
+        if (!menu.isEditing()) {
             hour++;
             hour %= 24;
             day++;
@@ -16,7 +16,7 @@ class BaseItemManyWidgets : public MenuItem {
 
   public:
     BaseItemManyWidgets(
-        const char* text,
+        MenuText text,
         std::vector<BaseWidget*> widgets,
         uint8_t activeWidget = 0)
         : MenuItem(text), widgets(widgets), activeWidget(constrain(activeWidget, 0, widgets.size())) {
@@ -30,7 +30,7 @@ class BaseItemManyWidgets : public MenuItem {
         }
     }
 
-    BaseWidget* getWidgetAt(const uint8_t index) const {
+    BaseWidget* getWidgetAt(const uint8_t index) const override {
         return index < widgets.size() ? widgets[index] : nullptr;
     }
 
@@ -71,6 +71,15 @@ class BaseItemManyWidgets : public MenuItem {
         }
     }
 
+    /**
+     * @brief Add the item, its widget list and its widgets to the report.
+     * Also records the length of the drawn value.
+     */
+    void report(MemoryReport& report) override {
+        reportItem(report, sizeof(*this));
+        reportWidgets(report);
+    }
+
     virtual ~BaseItemManyWidgets() {
         for (auto widget : widgets) {
             delete widget;
@@ -79,6 +88,19 @@ class BaseItemManyWidgets : public MenuItem {
 
   protected:
     virtual void handleCommit() = 0;
+    void reportWidgets(MemoryReport& report) {
+        char buf[ITEM_DRAW_BUFFER_SIZE];
+        uint8_t index = 0;
+        size_t length = 0;
+        report.add(MemoryReport::ITEM, widgets.capacity() * sizeof(BaseWidget*), 0);
+        for (auto* widget : widgets) {
+            widget->report(report);
+            uint8_t written = widget->draw(buf, index);
+            index += written;
+            length += written;
+        }
+        report.fitValue(length);
+    }
     /**
      * @brief Reset the active widget to the first widget.
      */
@@ -114,11 +136,14 @@ class BaseItemManyWidgets : public MenuItem {
 
         for (uint8_t i = 0; i < widgets.size(); i++) {
             index += widgets[i]->draw(buf, index);
-            if (i == activeWidget && MenuItem::isEditing()) {
+            if (i == activeWidget && renderer->isEditing()) {
+#if LCDMENU_VIEW_SHIFT
                 // Calculate the available space for the widgets after the text
-                size_t v_size = renderer->getEffectiveCols() - strlen(text) - 1;
+                // negative when the text is wider than the display
+                int16_t v_size = renderer->getEffectiveCols() - static_cast<int16_t>(text.drawnLength()) - 1;
                 // Adjust the view shift to ensure the active widget is visible
                 renderer->viewShift = index > v_size ? index - v_size : 0;
+#endif
                 // Draw the item with the renderer, indicating if it's the last widget
                 renderer->drawItem(text, buf, i == widgets.size() - 1);
                 // Calculate the cursor column position for the active widget
@@ -127,7 +152,7 @@ class BaseItemManyWidgets : public MenuItem {
         }
         renderer->drawItem(text, buf);
 
-        if (MenuItem::isEditing()) {
+        if (renderer->isEditing()) {
             renderer->moveCursor(cursorCol, renderer->getCursorRow());
         }
     }
@@ -157,7 +182,7 @@ class BaseItemManyWidgets : public MenuItem {
      */
     bool process(LcdMenu* menu, const unsigned char command) override {
         MenuRenderer* renderer = menu->getRenderer();
-        if (MenuItem::isEditing()) {
+        if (renderer->isEditing()) {
             if (widgets[activeWidget]->process(menu, command)) {
                 draw(renderer);
                 return true;
@@ -186,7 +211,7 @@ class BaseItemManyWidgets : public MenuItem {
         if (command == ENTER) {
             for (auto* w : widgets)
                 if (w) w->startEdit();
-            MenuItem::beginEdit();
+            renderer->beginEdit();
             draw(renderer);
             renderer->drawBlinker();
             LOG(F("ItemWidget::enterEditMode"), this->text);
@@ -212,8 +237,10 @@ class BaseItemManyWidgets : public MenuItem {
     }
 
     void back(MenuRenderer* renderer) {
-        MenuItem::endEdit();
+        renderer->endEdit();
+#if LCDMENU_VIEW_SHIFT
         renderer->viewShift = 0;
+#endif
         reset();
         handleCommit();
         renderer->clearBlinker();
@@ -222,8 +249,10 @@ class BaseItemManyWidgets : public MenuItem {
     }
 
     void cancel(MenuRenderer* renderer) {
-        MenuItem::endEdit();
+        renderer->endEdit();
+#if LCDMENU_VIEW_SHIFT
         renderer->viewShift = 0;
+#endif
         for (auto* w : widgets)
             if (w) w->cancelEdit();
         reset();
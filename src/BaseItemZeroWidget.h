@@ -23,7 +23,7 @@ class BaseItemZeroWidget : public MenuItem {
      *
      * @param text The text to display for the menu item.
      */
-    explicit BaseItemZeroWidget(const char* text) : MenuItem(text) {}
+    explicit BaseItemZeroWidget(MenuText text) : MenuItem(text) {}
 
   protected:
     virtual void handleCommit(LcdMenu* menu) = 0;
@@ -20,7 +20,7 @@ class ItemBack : public BaseItemZeroWidget {
      * Construct a new ItemBack object.
      * @param text The text of the item.
      */
-    ItemBack(const char* text) : BaseItemZeroWidget(text) {}
+    ItemBack(MenuText text) : BaseItemZeroWidget(text) {}
 
   protected:
     void handleCommit(LcdMenu* menu) override {
@@ -37,4 +37,4 @@ class ItemBack : public BaseItemZeroWidget {
  * @example
  *   auto item = ITEM_BACK("Back");
  */
-inline MenuItem* ITEM_BACK(const char* text = "..") { return new ItemBack(text); }
+inline MenuItem* ITEM_BACK(MenuText text = "..") { return new ItemBack(text); }
@@ -0,0 +1,180 @@
+#pragma once
+
+#include "BaseItemZeroWidget.h"
+#include "ObservableValue.h"
+#include "SharedValue.h"
+
+/**
+ * @class ItemBar
+ * @brief A menu item that shows a value as a horizontal bar.
+ *
+ * ```
+ * ┌────────────────────────────┐
+ * │ > T A N K : █ █ █ ▌        │
+ * └────────────────────────────┘
+ * ```
+ *
+ * Each cell of the bar has 5 pixel columns. Cells filled in part use the
+ * glyphs of `CharacterDisplayRenderer::setBarGlyphs`, without them a cell is
+ * shown full or empty.
+ *
+ * The value is bound like the one of `ItemValue`: a referenced value is
+ * polled, an `ObservableValue` is redrawn when it is set, a `SharedValue` is
+ * polled and read from a consistent copy. When the value changes only the
+ * cells whose glyph changed are sent again.
+ *
+ * @tparam T the type of the value
+ * @tparam V the type of stored value, `T` or `SharedValue<T>`
+ */
+template <typename T, typename V = T>
+class ItemBar : public BaseItemZeroWidget {
+  private:
+    V& value;
+    const T minValue;
+    const T maxValue;
+    const uint8_t width;
+    /**
+     * @brief Where the bar was last drawn in full, redrawn in place only on the same renderer and row.
+     * An item shown by two menus is drawn in full on each.
+     */
+    MenuRenderer* drawnRenderer = NULL;
+    uint8_t drawnRow = 0;
+    uint8_t drawnCol = 0;
+    uint8_t drawnWidth = 0;
+    uint8_t drawnLevel = 0;
+    /**
+     * @brief The value observed by the item, `NULL` when it is polled.
+     */
+    Observable* observed = NULL;
+
+    /**
+     * @brief Number of filled pixel columns for the current value.
+     */
+    uint8_t getLevel() const {
+        T current = snapshot(value);
+        if (current <= minValue) return 0;
+        if (current >= maxValue) return width * 5;
+        return static_cast<uint8_t>(static_cast<float>(current - minValue) * (width * 5) / static_cast<float>(maxValue - minValue));
+    }
+
+    /**
+     * @brief Filled pixel columns of cell `index` at `level`, 0 to 5.
+     */
+    static uint8_t getColumns(uint8_t level, uint8_t index) {
+        uint8_t start = index * 5;
+        return level <= start ? 0 : (level - start >= 5 ? 5 : level - start);
+    }
+
+  public:
+    ItemBar(MenuText text, V& value, const T min, const T max, const uint8_t width)
+        : BaseItemZeroWidget(text),
+          value(value),
+          minValue(min),
+          maxValue(max),
+          width(width < ITEM_DRAW_BUFFER_SIZE ? width : ITEM_DRAW_BUFFER_SIZE - 1) {
+        this->polling = true;
+    }
+
+    ItemBar(MenuText text, ObservableValue<T>& value, const T min, const T max, const uint8_t width)
+        : BaseItemZeroWidget(text),
+          value(value.value),
+          minValue(min),
+          maxValue(max),
+          width(width < ITEM_DRAW_BUFFER_SIZE ? width : ITEM_DRAW_BUFFER_SIZE - 1) {
+        // Polled like a reference when the value has no room for another observer
+        if (value.observe(this)) {
+            observed = &value;
+        } else {
+            this->polling = true;
+        }
+    }
+
+    ~ItemBar() noexcept override {
+        if (observed != NULL) observed->unobserve(this);
+    }
+
+    void report(MemoryReport& report) override {
+        reportItem(report, sizeof(*this));
+        report.fitValue(width);
+    }
+
+  protected:
+    void handleCommit(LcdMenu* /*menu*/) override {}
+
+    void draw(MenuRenderer* renderer) override {
+        char buffer[ITEM_DRAW_BUFFER_SIZE];
+        uint8_t level = getLevel();
+        for (uint8_t i = 0; i < width; i++) {
+            buffer[i] = renderer->getBarGlyph(getColumns(level, i));
+        }
+        buffer[width] = '\0';
+        renderer->drawItem(text, buffer);
+        drawnRenderer = renderer;
+        drawnRow = renderer->getCursorRow();
+        drawnCol = renderer->getValueCol();
+        drawnWidth = renderer->getValueWidth();
+        drawnLevel = level;
+    }
+
+    void update(MenuRenderer* renderer) override {
+        if (renderer != drawnRenderer || renderer->getCursorRow() != drawnRow || drawnWidth == 0) {
+            draw(renderer);
+            return;
+        }
+        uint8_t row = drawnRow;
+        uint8_t level = getLevel();
+        // Cells next to each other are sent after a single cursor move
+        uint8_t next = 0xFF;
+        for (uint8_t i = 0; i < drawnWidth; i++) {
+            uint8_t glyph = renderer->getBarGlyph(getColumns(level, i));
+            if (glyph == renderer->getBarGlyph(getColumns(drawnLevel, i))) continue;
+            if (i != next) renderer->moveCursor(drawnCol + i, row);
+            renderer->draw(glyph);
+            next = i + 1;
+        }
+        drawnLevel = level;
+    }
+};
+
+/**
+ * @brief Create a new item that shows a value as a bar.
+ * @note Call `LcdMenu::poll` in the loop function to follow the value.
+ *
+ * @tparam T the type of the value
+ * @param text the text to display for the item
+ * @param value the value to show, polled
+ * @param min the value of an empty bar
+ * @param max the value of a full bar
+ * @param width the number of cells of the bar
+ * @return MenuItem* the created item
+ *
+ * @example
+ *   uint8_t level = 40;
+ *   auto item = ITEM_BAR("Tank", level, (uint8_t)0, (uint8_t)100, 8);
+ */
+template <typename T>
+inline MenuItem* ITEM_BAR(MenuText text, T& value, const T min, const T max, const uint8_t width = 8) {
+    return new ItemBar<T>(text, value, min, max, width);
+}
+
+/**
+ * @brief Create a new item that shows an observable value as a bar.
+ * The item is redrawn by `LcdMenu::poll` only after the value is set.
+ *
+ * @example
+ *   ObservableValue<int> power(0);
+ *   auto item = ITEM_BAR("Power", power, 0, 1500, 10);
+ */
+template <typename T>
+inline MenuItem* ITEM_BAR(MenuText text, ObservableValue<T>& value, const T min, const T max, const uint8_t width = 8) {
+    return new ItemBar<T>(text, value, min, max, width);
+}
+
+/**
+ * @brief Create a new item that shows a value written by a task or an ISR as a bar.
+ * The value is polled and read from a consistent copy, see `SharedValue`.
+ */
+template <typename T>
+inline MenuItem* ITEM_BAR(MenuText text, SharedValue<T>& value, const T min, const T max, const uint8_t width = 8) {
+    return new ItemBar<T, SharedValue<T>>(text, value, min, max, width);
+}
@@ -19,11 +19,11 @@ class ItemBool : public ItemWidget<V> {
     virtual ~ItemBool() = default;
 
     ItemBool(
-        const char* text,
+        MenuText text,
         V value,
-        const char* textOn,
-        const char* textOff,
-        const char* format,
+        MenuText textOn,
+        MenuText textOff,
+        MenuText format,
         const uint8_t cursorOffset,
         typename ItemWidget<V>::CallbackType callback)
         : ItemWidget<V>(text, new WidgetBool<V>(value, textOn, textOff, format, cursorOffset), callback) {}
@@ -43,12 +43,12 @@ class ItemBool : public ItemWidget<V> {
  * @param cursorOffset the offset for the cursor position
  */
 inline ItemBool<bool>* ITEM_BOOL(
-    const char* text,
+    MenuText text,
     const bool value,
-    const char* textOn,
-    const char* textOff,
+    MenuText textOn,
+    MenuText textOff,
     void (*callback)(const bool),
-    const char* format = "%s",
+    MenuText format = "%s",
     const uint8_t cursorOffset = 0) {
     return new ItemBool<bool>(text, value, textOn, textOff, format, cursorOffset, callback);
 }
@@ -68,12 +68,12 @@ inline ItemBool<bool>* ITEM_BOOL(
  * @param cursorOffset the offset for the cursor position
  */
 inline ItemBool<Ref<bool>>* ITEM_BOOL_REF(
-    const char* text,
+    MenuText text,
     bool& value,
-    const char* textOn,
-    const char* textOff,
+    MenuText textOn,
+    MenuText textOff,
     void (*callback)(const Ref<bool>),
-    const char* format = "%s",
+    MenuText format = "%s",
     const uint8_t cursorOffset = 0) {
     return new ItemBool<Ref<bool>>(text, Ref<bool>(value), textOn, textOff, format, cursorOffset, callback);
 }
\ No newline at end of file
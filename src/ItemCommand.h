@@ -18,7 +18,9 @@ class ItemCommand : public BaseItemZeroWidget {
     void (*callback)();
 
   public:
-    ItemCommand(const char* text, void (*callback)()) : BaseItemZeroWidget(text), callback(callback) {}
+    ItemCommand(MenuText text, void (*callback)()) : BaseItemZeroWidget(text), callback(callback) {}
+
+    void report(MemoryReport& report) override { reportItem(report, sizeof(*this)); }
 
   protected:
     void handleCommit(LcdMenu* menu) override {
@@ -36,6 +38,6 @@ class ItemCommand : public BaseItemZeroWidget {
  * @example
  *   auto item = ITEM_COMMAND("Save", []() { save_data(); });
  */
-inline MenuItem* ITEM_COMMAND(const char* text, void (*callback)()) {
+inline MenuItem* ITEM_COMMAND(MenuText text, void (*callback)()) {
     return new ItemCommand(text, callback);
 }
\ No newline at end of file
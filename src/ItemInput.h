@@ -56,6 +56,14 @@ class ItemInput : public MenuItem {
      * Always in range [`view`, `view` + `viewSize` - 1].
      */
     uint8_t cursor;
+    /**
+     * @brief Size of the buffer this item allocated for `value`.
+     *
+     * 0 while `value` is the buffer passed by the user, which is never
+     * written to or freed. The first edit copies it into an own buffer that
+     * grows by doubling, so typing does not allocate on every keystroke.
+     */
+    uint8_t capacity = 0;
     /**
      * The call back that will be executed when edit will be finished.
      * First parameter will be a `value` string.
@@ -71,7 +79,7 @@ class ItemInput : public MenuItem {
      * @param callback A reference to the callback function to be invoked when
      * the input is submitted.
      */
-    ItemInput(const char* text, char* value, fptrStr callback)
+    ItemInput(MenuText text, char* value, fptrStr callback)
         : MenuItem(text), value(value), callback(callback) {}
     /**
      * Construct a new ItemInput object with no initial value.
@@ -80,8 +88,12 @@ class ItemInput : public MenuItem {
      * @param callback A reference to the callback function to be invoked when
      * the input is submitted.
      */
-    ItemInput(const char* text, fptrStr callback)
+    ItemInput(MenuText text, fptrStr callback)
         : ItemInput(text, (char*)"", callback) {}
+
+    ~ItemInput() noexcept override {
+        if (capacity > 0) delete[] value;
+    }
     /**
      * Get the current input value for this item.
      *
@@ -99,6 +111,10 @@ class ItemInput : public MenuItem {
      */
     bool setValue(char* value) {
         if (this->value != value) {
+            if (capacity > 0) {
+                delete[] this->value;
+                capacity = 0;
+            }
             this->value = value;
             LOG(F("ItemInput::setValue"), value);
             return true;
@@ -112,18 +128,44 @@ class ItemInput : public MenuItem {
      */
     fptrStr getCallbackStr() { return callback; }
 
+    void report(MemoryReport& report) override {
+        reportItem(report, sizeof(*this));
+        report.add(MemoryReport::TEXT, capacity > 0 ? capacity : strlen(value) + 1, 0);
+    }
+
   protected:
+    /**
+     * @brief Make sure `value` is an own buffer of at least `size` bytes.
+     * @return false if `size` does not fit in `capacity`
+     */
+    bool reserve(uint16_t size) {
+        if (size > 0xFF) {
+            return false;
+        }
+        if (capacity >= size) {
+            return true;
+        }
+        uint16_t grown = capacity < 8 ? 8 : capacity * 2;
+        if (grown < size) grown = size;
+        if (grown > 0xFF) grown = 0xFF;
+        char* buf = new char[grown];
+        strcpy(buf, value);
+        if (capacity > 0) {
+            delete[] value;
+        }
+        value = buf;
+        capacity = grown;
+        return true;
+    }
     void draw(MenuRenderer* renderer) override {
         const uint8_t viewSize = getViewSize(renderer);
-        char* vbuf = new char[viewSize + 1];
+        char vbuf[viewSize + 1];
         substring(value, view, viewSize, vbuf);
-        vbuf[viewSize] = '\0';
         renderer->drawItem(text, vbuf);
-        delete[] vbuf;
     }
     bool process(LcdMenu* menu, const unsigned char command) override {
         MenuRenderer* renderer = menu->getRenderer();
-        if (MenuItem::isEditing()) {
+        if (renderer->isEditing()) {
             if (isprint(command)) {
                 typeChar(renderer, command);
                 return true;
@@ -170,11 +212,11 @@ class ItemInput : public MenuItem {
         cursor = length;
         // Move view if needed
         uint8_t viewSize = getViewSize(renderer);
-        if (cursor > viewSize) {
+        if (cursor >= viewSize) {
             view = length - (viewSize - 1);
         }
         // Redraw
-        MenuItem::beginEdit();
+        renderer->beginEdit();
         draw(renderer);
         renderer->drawBlinker();
         // Log
@@ -182,7 +224,7 @@ class ItemInput : public MenuItem {
     };
     void back(MenuRenderer* renderer) {
         renderer->clearBlinker();
-        MenuItem::endEdit();
+        renderer->endEdit();
         // Move view to 0 and redraw before exit
         cursor = 0;
         view = 0;
@@ -235,7 +277,8 @@ class ItemInput : public MenuItem {
      * @brief Handles the backspace action for the input field.
      */
     void backspace(MenuRenderer* renderer) {
-        if (strlen(value) == 0 || cursor == 0) {
+        uint8_t length = strlen(value);
+        if (length == 0 || cursor == 0 || !reserve(length + 1)) {
             return;
         }
         remove(value, cursor - 1, 1);
@@ -256,8 +299,8 @@ class ItemInput : public MenuItem {
      * @brief Types a character into the current input value at the cursor position.
      *
      * This function inserts a character into the `value` string at the current cursor position.
-     * If the cursor is within the current length of the string, the string is split and the character
-     * is inserted in between. If the cursor is at the end of the string, the character is appended.
+     * The characters from the cursor on are moved one position to the right, the buffer only grows
+     * when it is full, see `capacity`.
      * The cursor is then incremented, and the view is adjusted if necessary.
      * Finally, the renderer is updated and the blinker position is reset.
      *
@@ -266,24 +309,22 @@ class ItemInput : public MenuItem {
      */
     void typeChar(MenuRenderer* renderer, const unsigned char character) {
         uint8_t length = strlen(value);
-        char* buf = new char[length + 2];
-        if (cursor < length) {
-            char start[length];
-            char end[length];
-            substring(value, 0, cursor, start);
-            substring(value, cursor, length - cursor, end);
-            concat(start, character, end, buf);
-        } else {
-            concat(value, character, buf);
+        if (!reserve(length + 2)) {
+            return;
         }
-        delete[] value;
-        value = buf;
+        memmove(value + cursor + 1, value + cursor, length - cursor + 1);
+        value[cursor] = character;
         cursor++;
         uint8_t viewSize = getViewSize(renderer);
+        uint8_t cursorCol = renderer->getCursorCol();
         if (cursor > (view + viewSize - 1)) {
             view++;
+        } else {
+            cursorCol++;
         }
         draw(renderer);
+        // Drawing leaves the display cursor after the value, put it back on the typed char
+        renderer->moveCursor(cursorCol, renderer->getCursorRow());
         renderer->drawBlinker();
         // Log
         LOG(F("ItemInput::typeChar"), character);
@@ -292,7 +333,11 @@ class ItemInput : public MenuItem {
      * @brief Clear the value of the input field
      */
     void clear(MenuRenderer* renderer) {
-        value[0] = '\0';
+        if (capacity > 0) {
+            value[0] = '\0';
+        } else {
+            value = (char*)"";
+        }
         cursor = 0;
         view = 0;
         draw(renderer);
@@ -3,8 +3,13 @@
 
 #include "ItemInput.h"
 #include "LcdMenu.h"
+#include "LcdMenuConfig.h"
 #include <utils/lcd_menu_utils.h>
 
+#if !LCDMENU_CHARSET_INPUT
+#error "Charset input is disabled, see LCDMENU_CHARSET_INPUT in LcdMenuConfig.h"
+#endif
+
 class ItemInputCharset : public ItemInput {
   private:
     const char* charset;
@@ -22,7 +27,7 @@ class ItemInputCharset : public ItemInput {
      * @param callback A reference to the callback function to be invoked when
      * the input is submitted.
      */
-    ItemInputCharset(const char* text, char* value, const char* charset, fptrStr callback)
+    ItemInputCharset(MenuText text, char* value, const char* charset, fptrStr callback)
         : ItemInput(text, value, callback), charset(charset) {}
 
     /**
@@ -32,13 +37,18 @@ class ItemInputCharset : public ItemInput {
      * @param callback A reference to the callback function to be invoked when
      * the input is submitted.
      */
-    ItemInputCharset(const char* text, const char* charset, fptrStr callback)
+    ItemInputCharset(MenuText text, const char* charset, fptrStr callback)
         : ItemInputCharset(text, (char*)"", charset, callback) {}
 
+    void report(MemoryReport& report) override {
+        reportItem(report, sizeof(*this));
+        report.add(MemoryReport::TEXT, (capacity > 0 ? capacity : strlen(value) + 1) + strlen(charset) + 1, 0);
+    }
+
   protected:
     bool process(LcdMenu* menu, const unsigned char command) override {
         MenuRenderer* renderer = menu->getRenderer();
-        if (MenuItem::isEditing()) {
+        if (renderer->isEditing()) {
             switch (command) {
                 case ENTER:
                     if (charEdit) {
@@ -104,7 +114,7 @@ class ItemInputCharset : public ItemInput {
     void initCharEdit() {
         charEdit = true;
         if (cursor < strlen(value)) {
-            char* e = strchr(charset, value[cursor]);
+            const char* e = strchr(charset, value[cursor]);
             if (e != NULL) {
                 charsetPosition = (int)(e - charset);
                 return;
@@ -132,13 +142,14 @@ class ItemInputCharset : public ItemInput {
      */
     void commitCharEdit(MenuRenderer* renderer) {
         uint8_t length = strlen(value);
-        if (cursor < length) {
-            value[cursor] = charset[charsetPosition];
-        } else {
-            char* buf = new char[length + 2];
-            concat(value, charset[charsetPosition], buf);
-            value = buf;
+        if (!reserve(length + 2)) {
+            abortCharEdit(renderer);
+            return;
+        }
+        if (cursor == length) {
+            value[length + 1] = '\0';
         }
+        value[cursor] = charset[charsetPosition];
         abortCharEdit(renderer);
         LOG(F("ItemInputCharset::commitCharEdit"), charset[charsetPosition]);
         ItemInput::right(renderer);
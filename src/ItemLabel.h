@@ -8,7 +8,7 @@
  */
 class ItemLabel final : public MenuItem {
   public:
-    explicit ItemLabel(const char* text) : MenuItem(text) {}
+    explicit ItemLabel(MenuText text) : MenuItem(text) {}
 
     bool isSelectable() const override { return false; }
 };
@@ -19,4 +19,4 @@ class ItemLabel final : public MenuItem {
  * @param text The text to display for the item.
  * @return ItemLabel* The created item. Caller takes ownership of the returned pointer.
  */
-inline ItemLabel* ITEM_LABEL(const char* text) { return new ItemLabel(text); }
+inline ItemLabel* ITEM_LABEL(MenuText text) { return new ItemLabel(text); }
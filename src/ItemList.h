@@ -22,10 +22,10 @@ class ItemList : public ItemWidget<V> {
     virtual ~ItemList() = default;
 
     ItemList(
-        const char* text,
+        MenuText text,
         const std::vector<T>& values,
         const V activePosition,
-        const char* format,
+        MenuText format,
         const uint8_t cursorOffset,
         const bool cycle,
         typename ItemWidget<V>::CallbackType callback) : ItemWidget<V>(text,
@@ -49,11 +49,11 @@ class ItemList : public ItemWidget<V> {
  */
 template <typename T>
 inline ItemList<T, uint8_t>* ITEM_LIST(
-    const char* text,
+    MenuText text,
     const std::vector<T>& values,
     void (*callback)(const uint8_t),
     const uint8_t activePosition = 0,
-    const char* format = "%s",
+    MenuText format = "%s",
     const uint8_t cursorOffset = 0,
     const bool cycle = false) {
     return new ItemList<T, uint8_t>(text, values, activePosition, format, cursorOffset, cycle, callback);
@@ -76,11 +76,11 @@ inline ItemList<T, uint8_t>* ITEM_LIST(
  */
 template <typename T>
 inline ItemList<T, Ref<uint8_t>>* ITEM_LIST_REF(
-    const char* text,
+    MenuText text,
     const std::vector<T>& values,
     void (*callback)(const Ref<uint8_t>),
     uint8_t& activePosition,
-    const char* format = "%s",
+    MenuText format = "%s",
     const uint8_t cursorOffset = 0,
     const bool cycle = false) {
     return new ItemList<T, Ref<uint8_t>>(text, values, Ref<uint8_t>(activePosition), format, cursorOffset, cycle, callback);
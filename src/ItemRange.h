@@ -21,12 +21,12 @@ class ItemRange : public ItemWidget<V> {
     virtual ~ItemRange() = default;
 
     ItemRange(
-        const char* text,
+        MenuText text,
         const V value,
         const T step,
         const T min,
         const T max,
-        const char* format,
+        MenuText format,
         const uint8_t cursorOffset,
         const bool cycle,
         typename ItemWidget<V>::CallbackType callback) : ItemWidget<V>(text,
@@ -52,13 +52,13 @@ class ItemRange : public ItemWidget<V> {
  */
 template <typename T>
 inline ItemRange<T, T>* ITEM_RANGE(
-    const char* text,
+    MenuText text,
     const T value,
     const T step,
     const T min,
     const T max,
     void (*callback)(const T),
-    const char* format = "%s",
+    MenuText format = "%s",
     const uint8_t cursorOffset = 0,
     const bool cycle = false) {
     return new ItemRange<T, T>(text, value, step, min, max, format, cursorOffset, cycle, callback);
@@ -82,14 +82,44 @@ inline ItemRange<T, T>* ITEM_RANGE(
  */
 template <typename T>
 inline ItemRange<T, Ref<T>>* ITEM_RANGE_REF(
-    const char* text,
+    MenuText text,
     T& value,
     const T step,
     const T min,
     const T max,
     void (*callback)(const Ref<T>),
-    const char* format = "%s",
+    MenuText format = "%s",
     const uint8_t cursorOffset = 0,
     const bool cycle = false) {
     return new ItemRange<T, Ref<T>>(text, Ref<T>(value), step, min, max, format, cursorOffset, cycle, callback);
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Create a new item that displays a range of values shared with a task or an ISR.
+ *
+ * The item reads consistent copies of the value, see `SharedValue`.
+ *
+ * @tparam T the type of the values in the range
+ * @param text the text to display for the item
+ * @param value the shared value to display
+ * @param step the step size for incrementing/decrementing the value (use negative value to invert the range)
+ * @param min the minimum value in the range
+ * @param max the maximum value in the range
+ * @param callback the callback function to call when the value changes
+ * @param format the format string to use when displaying the values
+ * @param cursorOffset the offset for the cursor position
+ * @param cycle whether to cycle through the range when reaching the end
+ */
+template <typename T>
+inline ItemRange<T, SharedRef<T>>* ITEM_RANGE_REF(
+    MenuText text,
+    SharedValue<T>& value,
+    const T step,
+    const T min,
+    const T max,
+    void (*callback)(const SharedRef<T>),
+    MenuText format = "%s",
+    const uint8_t cursorOffset = 0,
+    const bool cycle = false) {
+    return new ItemRange<T, SharedRef<T>>(text, SharedRef<T>(value), step, min, max, format, cursorOffset, cycle, callback);
+}
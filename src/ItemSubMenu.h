@@ -20,7 +20,7 @@ class ItemSubMenu : public BaseItemZeroWidget {
      * @param text text to display for the item
      * @param screen the next screen to show
      */
-    ItemSubMenu(const char* text, MenuScreen*& screen) : BaseItemZeroWidget(text), screen(screen) {}
+    ItemSubMenu(MenuText text, MenuScreen*& screen) : BaseItemZeroWidget(text), screen(screen) {}
 
     /**
      * @brief Set the screen to navigate to when the item is selected.
@@ -33,11 +33,18 @@ class ItemSubMenu : public BaseItemZeroWidget {
         this->screen = screen;
     }
 
+    /**
+     * @brief Add this item to the report.
+     * The screen it opens is not included as it can be shared between items,
+     * report it with `MenuScreen::report`.
+     */
+    void report(MemoryReport& report) override { reportItem(report, sizeof(*this)); }
+
   protected:
     void handleCommit(LcdMenu* menu) override {
         LOG(F("ItemSubMenu::changeScreen"), text);
         screen->setParent(menu->getScreen());
-        menu->setScreen(screen);
+        menu->openScreen(screen);
     }
 };
 
@@ -51,6 +58,6 @@ class ItemSubMenu : public BaseItemZeroWidget {
  * @example
  *   auto item = ITEM_SUBMENU("Settings", settingsScreen);
  */
-inline MenuItem* ITEM_SUBMENU(const char* text, MenuScreen*& screen) {
+inline MenuItem* ITEM_SUBMENU(MenuText text, MenuScreen*& screen) {
     return new ItemSubMenu(text, screen);
 }
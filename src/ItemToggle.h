@@ -19,8 +19,8 @@
 class ItemToggle : public MenuItem {
   private:
     bool enabled = false;
-    const char* textOn = NULL;
-    const char* textOff = NULL;
+    MenuText textOn;
+    MenuText textOff;
     fptrBool callback = NULL;
 
   public:
@@ -30,7 +30,7 @@ class ItemToggle : public MenuItem {
      * @param key key of the item
      * @param callback reference to callback function
      */
-    ItemToggle(const char* key, fptrBool callback)
+    ItemToggle(MenuText key, fptrBool callback)
         : ItemToggle(key, false, callback) {}
 
     /**
@@ -41,7 +41,7 @@ class ItemToggle : public MenuItem {
      * @param enabled
      * @param callback
      */
-    ItemToggle(const char* text, boolean enabled, fptrBool callback)
+    ItemToggle(MenuText text, boolean enabled, fptrBool callback)
         : ItemToggle(text, "ON", "OFF", callback) {
         this->enabled = enabled;
     }
@@ -53,7 +53,7 @@ class ItemToggle : public MenuItem {
      * @param textOff display text when OFF
      * @param callback reference to callback function
      */
-    ItemToggle(const char* text, const char* textOn, const char* textOff, fptrBool callback)
+    ItemToggle(MenuText text, MenuText textOn, MenuText textOff, fptrBool callback)
         : MenuItem(text),
           textOn(textOn),
           textOff(textOff),
@@ -78,12 +78,19 @@ class ItemToggle : public MenuItem {
      */
     void setIsOn(boolean isOn) { this->enabled = isOn; }
 
-    const char* getTextOn() { return this->textOn; }
+    const char* getTextOn() { return this->textOn.text; }
 
-    const char* getTextOff() { return this->textOff; }
+    const char* getTextOff() { return this->textOff.text; }
+
+    void report(MemoryReport& report) override {
+        reportItem(report, sizeof(*this));
+        report.addText(textOn);
+        report.addText(textOff);
+    }
 
     void draw(MenuRenderer* renderer) override {
-        renderer->drawItem(text, enabled ? textOn : textOff);
+        char buffer[ITEM_DRAW_BUFFER_SIZE];
+        renderer->drawItem(text, (enabled ? textOn : textOff).load(buffer, sizeof(buffer)));
     };
 
   protected:
@@ -3,6 +3,8 @@
 #include "utils/custom_printf.h"
 
 #include "BaseItemZeroWidget.h"
+#include "ObservableValue.h"
+#include "SharedValue.h"
 
 /**
  * @class ItemValue
@@ -11,24 +13,54 @@
  * This class extends the BaseItemZeroWidget class and provides a menu item
  * that displays a value. The value is provided as a reference during construction
  * and is displayed using the provided format string.
+ *
+ * A referenced value is polled. A value bound as an `ObservableValue` is
+ * only redrawn when it is set. A `SharedValue` written by a task or an ISR
+ * is polled and drawn from a consistent copy.
  */
 template <typename T>
 class ItemValue : public BaseItemZeroWidget {
   private:
     T& value;
-    const char* format;
+    MenuText format;
+    /**
+     * @brief The value observed by the item, `NULL` when it is polled.
+     */
+    Observable* observed = NULL;
 
   public:
-    ItemValue(const char* text, T& value, const char* format) : BaseItemZeroWidget(text), value(value), format(format) {
+    ItemValue(MenuText text, T& value, MenuText format) : BaseItemZeroWidget(text), value(value), format(format) {
         this->polling = true;
     }
 
+    ItemValue(MenuText text, ObservableValue<T>& value, MenuText format)
+        : BaseItemZeroWidget(text), value(value.value), format(format) {
+        // Polled like a reference when the value has no room for another observer
+        if (value.observe(this)) {
+            observed = &value;
+        } else {
+            this->polling = true;
+        }
+    }
+
+    ~ItemValue() noexcept override {
+        if (observed != NULL) observed->unobserve(this);
+    }
+
+    void report(MemoryReport& report) override {
+        reportItem(report, sizeof(*this));
+        char buffer[ITEM_DRAW_BUFFER_SIZE];
+        char formatBuffer[ITEM_DRAW_BUFFER_SIZE];
+        report.fitValue(snprintf(buffer, ITEM_DRAW_BUFFER_SIZE, format.load(formatBuffer, sizeof(formatBuffer)), snapshot(value)));
+    }
+
   protected:
     void handleCommit(LcdMenu* menu) override {}
 
     void draw(MenuRenderer* renderer) override {
         char buffer[ITEM_DRAW_BUFFER_SIZE];
-        snprintf(buffer, ITEM_DRAW_BUFFER_SIZE, format, value);
+        char formatBuffer[ITEM_DRAW_BUFFER_SIZE];
+        snprintf(buffer, ITEM_DRAW_BUFFER_SIZE, format.load(formatBuffer, sizeof(formatBuffer)), snapshot(value));
         renderer->drawItem(text, buffer);
     }
 };
@@ -50,8 +82,24 @@ class ItemValue : public BaseItemZeroWidget {
  */
 template <typename T>
 inline MenuItem* ITEM_VALUE(
-    const char* text,
+    MenuText text,
     T& value,
-    const char* format = "%s") {
+    MenuText format = "%s") {
+    return new ItemValue<T>(text, value, format);
+}
+
+/**
+ * @brief Create a new item that displays an observable value.
+ * The item is redrawn by `LcdMenu::poll` only after the value is set.
+ *
+ * @example
+ *   ObservableValue<int> rpm(0);
+ *   auto item = ITEM_VALUE("RPM", rpm, "%d");
+ */
+template <typename T>
+inline MenuItem* ITEM_VALUE(
+    MenuText text,
+    ObservableValue<T>& value,
+    MenuText format = "%s") {
     return new ItemValue<T>(text, value, format);
 }
\ No newline at end of file
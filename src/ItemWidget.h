@@ -47,9 +47,14 @@ class ItemWidget : public BaseItemManyWidgets {
 
   public:
     // Constructor for one or more widgets
-    ItemWidget(const char* text, BaseWidgetValue<Ts>*... widgetPtrs, CallbackType callback = nullptr)
+    ItemWidget(MenuText text, BaseWidgetValue<Ts>*... widgetPtrs, CallbackType callback = nullptr)
         : BaseItemManyWidgets(text, std::vector<BaseWidget*>{widgetPtrs...}), callback(callback) {}
 
+    void report(MemoryReport& report) override {
+        this->reportItem(report, sizeof(*this));
+        this->reportWidgets(report);
+    }
+
     void setValues(Ts... values) {
         setValuesImpl(typename make_index_sequence<sizeof...(Ts)>::type{}, values...);
     }
@@ -74,7 +79,7 @@ template <typename... Ts>
  * @param widgetPtrs pointers to the widgets associated with this item
  */
 inline MenuItem* ITEM_WIDGET(
-    const char* text,
+    MenuText text,
     typename ItemWidget<Ts...>::CallbackType callback,
     BaseWidgetValue<Ts>*... widgetPtrs) {
     return new ItemWidget<Ts...>(text, widgetPtrs..., callback);
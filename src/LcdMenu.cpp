@@ -5,26 +5,87 @@ MenuRenderer* LcdMenu::getRenderer() {
 }
 
 MenuScreen* LcdMenu::getScreen() {
+    return screen != NULL ? restorePosition() : NULL;
+}
+
+MenuScreen* LcdMenu::restorePosition() {
+    screen->cursor = cursor;
+    screen->view = view;
     return screen;
 }
 
+void LcdMenu::savePosition() {
+    cursor = screen->cursor;
+    view = screen->view;
+}
+
+void LcdMenu::showScreen(MenuScreen* screen, uint8_t cursor, uint8_t view) {
+    overlay.rows = 0;
+    this->screen = screen;
+    screen->restore(&renderer, cursor, view);
+    screen->clearEmptyRows(&renderer);
+    savePosition();
+}
+
 void LcdMenu::setScreen(MenuScreen* screen) {
     LOG(F("LcdMenu::setScreen"));
-    this->screen = screen;
-    renderer.display->clear();
-    this->screen->reset(&renderer);
+    historySize = 0;
+    showScreen(screen, 0, 0);
+}
+
+void LcdMenu::openScreen(MenuScreen* screen) {
+    LOG(F("LcdMenu::openScreen"));
+    if (this->screen != NULL) {
+        if (historySize == MENU_HISTORY_DEPTH) {
+            memmove(history, history + 1, (MENU_HISTORY_DEPTH - 1) * sizeof(HistoryEntry));
+            historySize--;
+        }
+        history[historySize++] = {this->screen, cursor, view};
+    }
+    showScreen(screen, 0, 0);
+}
+
+bool LcdMenu::back() {
+    if (historySize > 0) {
+        HistoryEntry& entry = history[--historySize];
+        showScreen(entry.screen, entry.cursor, entry.view);
+        LOG(F("LcdMenu::back"), cursor);
+        return true;
+    }
+    MenuScreen* parent = restorePosition()->parent;
+    if (parent == NULL) {
+        return false;
+    }
+    showScreen(parent, 0, 0);
+    LOG(F("LcdMenu::back"), cursor);
+    return true;
 }
 
 bool LcdMenu::process(const unsigned char c) {
     if (!enabled) {
         return false;
     }
-    renderer.restartTimer();
-    return screen->process(this, c);
+    restorePosition();
+    if (latencyProbe != NULL) {
+        latencyProbe->begin(c, screen->size() > 0 ? screen->getItemAt(cursor) : NULL);
+    }
+    bool wasOff = renderer.getPowerState() == MenuRenderer::OFF;
+    bool swallowed = renderer.wake();
+    if (wasOff && stale && overlay.rows == 0) {
+        stale = false;
+        screen->draw(&renderer);
+    }
+    bool processed = swallowed || processOverlay(c) || screen->process(this, c);
+    savePosition();
+    if (latencyProbe != NULL) {
+        latencyProbe->end();
+    }
+    return processed;
 };
 
 void LcdMenu::reset() {
-    this->screen->setCursor(&renderer, 0);
+    restorePosition()->setCursor(&renderer, 0);
+    savePosition();
 }
 
 void LcdMenu::hide() {
@@ -32,6 +93,7 @@ void LcdMenu::hide() {
         return;
     }
     enabled = false;
+    overlay.rows = 0;
     renderer.display->clear();
 }
 
@@ -40,19 +102,23 @@ void LcdMenu::show() {
         return;
     }
     enabled = true;
-    renderer.display->clear();
-    screen->draw(&renderer);
+    if (renderer.display->skipsUnchanged()) {
+        renderer.display->clear();
+    }
+    restorePosition()->draw(&renderer);
+    screen->clearEmptyRows(&renderer);
 }
 
 uint8_t LcdMenu::getCursor() {
-    return screen->getCursor();
+    return cursor;
 }
 
 void LcdMenu::setCursor(uint8_t cursor) {
     if (!enabled) {
         return;
     }
-    screen->setCursor(&renderer, cursor);
+    restorePosition()->setCursor(&renderer, cursor);
+    savePosition();
 }
 
 MenuItem* LcdMenu::getItemAt(uint8_t position) {
@@ -63,15 +129,151 @@ void LcdMenu::refresh() {
     if (!enabled) {
         return;
     }
-    screen->draw(&renderer);
+    if (renderer.getPowerState() == MenuRenderer::OFF || overlay.rows != 0) {
+        stale = true;
+        return;
+    }
+    restorePosition()->draw(&renderer);
 }
 
 void LcdMenu::poll(uint16_t pollInterval) {
-    if (!enabled || pollInterval == 0) {
+    TRACE_DRAIN();
+    if (!enabled) {
+        return;
+    }
+    renderer.animate();
+    if (overlay.rows != 0) {
+        if (overlay.timeout != 0 && getClock()->now() - overlay.shownAt >= overlay.timeout) {
+            fptrBool callback = overlay.callback;
+            dismissOverlay();
+            if (callback != NULL) callback(false);
+        }
+        return;
+    }
+    if (pollInterval == 0) {
+        return;
+    }
+    if (renderer.getPowerState() == MenuRenderer::OFF) {
+        stale = true;
+        return;
+    }
+    restorePosition()->poll(&renderer, pollInterval < 100 ? 100 : pollInterval);
+}
+
+void LcdMenu::refreshDirty() {
+    if (!enabled || renderer.isEditing() || overlay.rows != 0) {
+        return;
+    }
+    if (renderer.getPowerState() == MenuRenderer::OFF) {
+        stale = true;
         return;
     }
-    screen->poll(&renderer, pollInterval < 100 ? 100 : pollInterval);
+    restorePosition()->drawDirty(&renderer);
 }
+
+void LcdMenu::showOverlay(MenuText message, uint16_t timeout, bool fullScreen, fptrBool callback) {
+    if (!enabled) {
+        return;
+    }
+    uint8_t rows = renderer.getMaxRows();
+    // A message shown before covers the rows from `coveredRow` to the last one
+    uint8_t coveredRow = overlay.rows != 0 ? overlay.firstRow : rows;
+    overlay = {getClock()->now(), timeout, static_cast<uint8_t>(fullScreen ? 0 : rows - 1), static_cast<uint8_t>(fullScreen ? rows : 1), callback};
+    if (coveredRow < overlay.firstRow) {
+        // Rows of the previous message the new one leaves show the menu again
+        MenuScreen* screen = restorePosition();
+        if (stale && renderer.getPowerState() != MenuRenderer::OFF) {
+            stale = false;
+            screen->draw(&renderer);
+        } else {
+            screen->drawRows(&renderer, coveredRow, overlay.firstRow - coveredRow);
+        }
+    }
+    if (renderer.isEditing()) {
+        renderer.clearBlinker();
+    }
+    char line[ITEM_DRAW_BUFFER_SIZE];
+    size_t index = 0;
+    for (uint8_t row = overlay.firstRow; row < rows; row++) {
+        uint8_t length = 0;
+        char c = message.isNull() ? '\0' : message.charAt(index);
+        for (; c != '\0' && c != '\n'; c = message.charAt(++index)) {
+            if (length < sizeof(line) - 1) line[length++] = c;
+        }
+        if (c == '\n') index++;
+        line[length] = '\0';
+        renderer.drawMessage(row, line);
+    }
+    LOG(F("LcdMenu::showOverlay"), message);
+}
+
+void LcdMenu::dismissOverlay() {
+    if (overlay.rows == 0) {
+        return;
+    }
+    uint8_t firstRow = overlay.firstRow;
+    uint8_t rows = overlay.rows;
+    overlay.rows = 0;
+    MenuScreen* screen = restorePosition();
+    if (stale && renderer.getPowerState() != MenuRenderer::OFF) {
+        stale = false;
+        screen->draw(&renderer);
+    } else {
+        screen->drawRows(&renderer, firstRow, rows);
+    }
+    if (renderer.isEditing() && screen->size() > 0) {
+        // Leave the cursor of the display on the edited item
+        screen->drawRow(cursor - view, &renderer);
+        renderer.drawBlinker();
+    }
+    LOG(F("LcdMenu::dismissOverlay"));
+}
+
+bool LcdMenu::processOverlay(const unsigned char command) {
+    if (overlay.rows == 0) {
+        return false;
+    }
+    fptrBool callback = overlay.callback;
+    if (callback == NULL) {
+        dismissOverlay();
+        return false;
+    }
+    if (command == ENTER || command == BACK) {
+        dismissOverlay();
+        callback(command == ENTER);
+    }
+    return true;
+}
+
+bool LcdMenu::hasOverlay() const {
+    return overlay.rows != 0;
+}
+
+bool LcdMenu::isEditing() const {
+    return renderer.isEditing();
+}
+
 bool LcdMenu::isEnabled() const {
     return enabled;
-}
\ No newline at end of file
+}
+
+void LcdMenu::memoryReport(MemoryReport& report) {
+    report.add(MemoryReport::MENU, sizeof(LcdMenu));
+    renderer.report(report);
+    if (screen != NULL) {
+        screen->report(report);
+    }
+    report.sampleHeap();
+}
+
+void LcdMenu::setLatencyProbe(LatencyProbe* probe) {
+    latencyProbe = probe;
+}
+
+LatencyProbe* LcdMenu::getLatencyProbe() {
+    return latencyProbe;
+}
+
+Clock* LcdMenu::getClock() {
+    return renderer.getClock();
+}
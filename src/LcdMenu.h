@@ -26,11 +26,24 @@
 #pragma once
 
 #include "MenuScreen.h"
+#include "diagnostics/LatencyProbe.h"
 #include "renderer/MenuRenderer.h"
 #include "utils/lcd_menu_constants.h"
 #include <MenuItem.h>
 #include <utils/lcd_menu_utils.h>
 
+/**
+ * Number of screens whose position is kept when opening a submenu, see `LcdMenu::openScreen`.
+ * When more are opened, the oldest is forgotten and `BACK` shows its parent from the top.
+ */
+#ifndef MENU_HISTORY_DEPTH
+#ifdef __AVR__
+#define MENU_HISTORY_DEPTH 4
+#else
+#define MENU_HISTORY_DEPTH 8
+#endif
+#endif
+
 /**
  * @class LcdMenu
  * @brief Represents the main menu object.
@@ -56,6 +69,67 @@ class LcdMenu {
      * set it back to `true` to show the menu.
      */
     bool enabled = true;
+    /**
+     * @brief A refresh or poll was skipped while the display was off.
+     * The screen is redrawn when the display wakes up.
+     */
+    bool stale = false;
+    /**
+     * @brief Optional probe measuring the latency of `process`.
+     */
+    LatencyProbe* latencyProbe = NULL;
+    /**
+     * @brief Cursor and view of this menu on the current screen.
+     * A screen can be shown by several menus, each one moves it to its own
+     * position before using it, see `restorePosition`.
+     */
+    uint8_t cursor = 0;
+    uint8_t view = 0;
+    /**
+     * @brief A screen left for a submenu and the position to show it at on `BACK`.
+     */
+    struct HistoryEntry {
+        MenuScreen* screen;
+        uint8_t cursor;
+        uint8_t view;
+    };
+    HistoryEntry history[MENU_HISTORY_DEPTH];
+    uint8_t historySize = 0;
+    /**
+     * @brief The message shown over the menu, see `showOverlay`.
+     */
+    struct Overlay {
+        unsigned long shownAt;
+        uint16_t timeout;
+        uint8_t firstRow;
+        /**
+         * @brief Number of rows covered, `0` when no message is shown.
+         */
+        uint8_t rows;
+        fptrBool callback;
+    } overlay = {};
+
+    /**
+     * @brief Handle `command` while a message is shown.
+     * @return `true` if the message took the command
+     */
+    bool processOverlay(const unsigned char command);
+
+    /**
+     * @brief Move the current screen to the position of this menu.
+     * @return the current screen
+     */
+    MenuScreen* restorePosition();
+    /**
+     * @brief Keep the position of the current screen as the position of this menu.
+     */
+    void savePosition();
+    /**
+     * @brief Show `screen` at `cursor` and `view`.
+     * The display is not cleared: every row is overwritten and the rows below
+     * the last item are blanked, so the panel never shows an empty frame.
+     */
+    void showScreen(MenuScreen* screen, uint8_t cursor, uint8_t view);
 
   public:
     /**
@@ -74,11 +148,23 @@ class LcdMenu {
     MenuScreen* getScreen();
     /**
      * @brief Set new screen to display.
-     * The only place that clears whole screen.
-     * Then it will draw the new screen using the renderer.
+     * Draws the new screen from the top over the previous one.
+     * The screens opened before are forgotten.
      * @param screen the new screen to display
      */
     void setScreen(MenuScreen* screen);
+    /**
+     * @brief Open `screen` from the current screen, used by submenus.
+     * `BACK` shows the current screen again with the same cursor and view.
+     * @param screen the screen to display
+     */
+    void openScreen(MenuScreen* screen);
+    /**
+     * @brief Go back to the screen opened before, at the position it was left.
+     * Without one, shows the parent of the current screen from the top, see `MenuScreen::setParent`.
+     * @return `true` if a screen was shown
+     */
+    bool back();
     /**
      * @brief Process the input character.
      * @param c the input character
@@ -99,6 +185,9 @@ class LcdMenu {
     void hide();
     /**
      * @brief Show the menu.
+     * The screen is drawn over what the sketch displayed, except on displays
+     * that skip unchanged characters: they are cleared first, as the sketch
+     * may have drawn without them knowing.
      */
     void show();
     /**
@@ -118,6 +207,7 @@ class LcdMenu {
     MenuItem* getItemAt(uint8_t position);
     /**
      * @brief Refresh the current screen.
+     * While the display is off the screen is redrawn when it wakes up instead.
      */
     void refresh();
     /**
@@ -125,13 +215,80 @@ class LcdMenu {
      *        This method is used to update the menu at regular intervals,
      *        for example, when a value bound to an item changes, the menu needs to be updated.
      *        This method should be called in the `loop` function of the sketch.
+     *        Nothing is drawn while the display is off.
+     *        Items can be polled at their own interval, see `MenuItem::setPollInterval`.
      *
      * @param pollInterval the interval to update the menu in milliseconds (default is 1000)
      */
     void poll(uint16_t pollInterval = 1000);
+    /**
+     * @brief Redraw the visible items marked dirty now instead of on the next `poll`.
+     * Items being edited are redrawn once editing ends.
+     */
+    void refreshDirty();
+    /**
+     * @brief Show `message` over the menu without leaving it.
+     *
+     * A one-row message covers the last row, a full-screen one covers every
+     * row with one line of the message per row, lines are separated by `\n`.
+     * Lines are centered. When the message is dismissed only the rows it
+     * covered are drawn again. A message shown over another one replaces it,
+     * the rows only the previous one covered show the menu again.
+     *
+     * Nothing is polled while the message is shown, a `refresh` is delayed
+     * until it is dismissed and changing screens dismisses it.
+     *
+     * @param message the message, in RAM or in flash
+     * @param timeout milliseconds before `poll` dismisses the message, `0` to keep it
+     * @param fullScreen `true` to cover every row
+     * @param callback when set the message takes every input and is answered
+     *        with `true` on `ENTER`, `false` on `BACK` or timeout; otherwise
+     *        any input dismisses it then goes to the menu
+     *
+     * @example
+     *   menu.showOverlay(F("Saved"));
+     *   menu.showOverlay(F("Reset all?\nENTER:yes BACK:no"), 0, true, onReset);
+     */
+    void showOverlay(MenuText message, uint16_t timeout = 2000, bool fullScreen = false, fptrBool callback = NULL);
+    /**
+     * @brief Dismiss the message shown over the menu, without calling its callback.
+     */
+    void dismissOverlay();
+    /**
+     * @brief Check if a message is shown over the menu.
+     */
+    bool hasOverlay() const;
+    /**
+     * @brief Check if an item is being edited on this menu.
+     * Menus on other displays have their own edit state.
+     */
+    bool isEditing() const;
     /**
      * @brief Get the current status of the menu, enabled / disabled
      * @return the value of private var 'enabled'
      */
     bool isEnabled() const;
+    /**
+     * @brief Add the memory taken by the menu, its renderer and the current
+     *        screen to the report, then sample the heap.
+     *        Other screens can be added to the same report with `MenuScreen::report`.
+     *
+     * @param report the report to fill
+     */
+    void memoryReport(MemoryReport& report);
+    /**
+     * @brief Measure the latency of every processed command with `probe`.
+     * @param probe the probe to use, `NULL` to stop measuring
+     */
+    void setLatencyProbe(LatencyProbe* probe);
+    /**
+     * @brief Get the attached latency probe.
+     * @return the probe or `NULL`
+     */
+    LatencyProbe* getLatencyProbe();
+    /**
+     * @brief Get the clock of the renderer, used by the input adapters.
+     * @return the clock, never `NULL`
+     */
+    Clock* getClock();
 };
@@ -0,0 +1,82 @@
+#pragma once
+
+/**
+ * Compile-time configuration of LcdMenu.
+ *
+ * Pick a profile with `LCDMENU_PROFILE`, then override single features if
+ * needed. Both are set for the whole build, for example
+ * `build_flags = -DLCDMENU_PROFILE=LCDMENU_PROFILE_MINIMAL -DLCDMENU_WIDGETS=1`
+ * in PlatformIO. Every feature is `1` (compiled in) or `0` (compiled out).
+ *
+ * | Feature                      | FULL | STANDARD | MINIMAL |
+ * |------------------------------|------|----------|---------|
+ * | `LCDMENU_FLOAT`              | 1    | 0        | 0       |
+ * | `LCDMENU_SCROLL_INDICATORS`  | 1    | 1        | 0       |
+ * | `LCDMENU_VIEW_SHIFT`         | 1    | 1        | 0       |
+ * | `LCDMENU_WIDGETS`            | 1    | 1        | 0       |
+ * | `LCDMENU_CHARSET_INPUT`      | 1    | 0        | 0       |
+ * | `LCDMENU_DYNAMIC_SCREENS`    | 1    | 0        | 0       |
+ *
+ * Features that live in their own headers cost nothing until they are
+ * included; switching them off turns their use into a compile error and
+ * removes the hooks the rest of the library keeps for them.
+ *
+ * This file is also included from C, keep it to preprocessor definitions.
+ */
+
+#define LCDMENU_PROFILE_FULL 0
+#define LCDMENU_PROFILE_STANDARD 1
+#define LCDMENU_PROFILE_MINIMAL 2
+
+#ifndef LCDMENU_PROFILE
+#define LCDMENU_PROFILE LCDMENU_PROFILE_FULL
+#endif
+
+/**
+ * `%f` in the formats of the built-in `printf`, used on boards whose
+ * `snprintf` has no float support (see `USE_CUSTOM_PRINTF`). Without it,
+ * float values have to be formatted by the sketch.
+ */
+#ifndef LCDMENU_FLOAT
+#define LCDMENU_FLOAT (LCDMENU_PROFILE == LCDMENU_PROFILE_FULL)
+#endif
+
+/**
+ * Up and down arrows of `CharacterDisplayRenderer` showing that there are
+ * more items above or below. Without them the renderer takes no arrow glyphs
+ * and the last column is free for items.
+ */
+#ifndef LCDMENU_SCROLL_INDICATORS
+#define LCDMENU_SCROLL_INDICATORS (LCDMENU_PROFILE != LCDMENU_PROFILE_MINIMAL)
+#endif
+
+/**
+ * Shifting the focused row with `LEFT` and `RIGHT` to show text and values
+ * that do not fit. Without it, `MenuRenderer::viewShift` is always `0`.
+ */
+#ifndef LCDMENU_VIEW_SHIFT
+#define LCDMENU_VIEW_SHIFT (LCDMENU_PROFILE != LCDMENU_PROFILE_MINIMAL)
+#endif
+
+/**
+ * Widgets and the items built on them: `ItemWidget`, `ItemRange`,
+ * `ItemList`, `ItemBool` and `RemoteControl`.
+ */
+#ifndef LCDMENU_WIDGETS
+#define LCDMENU_WIDGETS (LCDMENU_PROFILE != LCDMENU_PROFILE_MINIMAL)
+#endif
+
+/**
+ * `ItemInputCharset`, text input picking characters from a charset.
+ */
+#ifndef LCDMENU_CHARSET_INPUT
+#define LCDMENU_CHARSET_INPUT (LCDMENU_PROFILE == LCDMENU_PROFILE_FULL)
+#endif
+
+/**
+ * Adding and removing items of a `MenuScreen` at runtime.
+ * Without it, screens keep the items they were created with.
+ */
+#ifndef LCDMENU_DYNAMIC_SCREENS
+#define LCDMENU_DYNAMIC_SCREENS (LCDMENU_PROFILE == LCDMENU_PROFILE_FULL)
+#endif
@@ -1,7 +1,5 @@
 #include "MenuItem.h"
 
-bool MenuItem::_isEditing = false;
-
-bool MenuItem::isEditing() { return _isEditing; }
-void MenuItem::beginEdit() { _isEditing = true; }
-void MenuItem::endEdit() { _isEditing = false; }
+bool MenuItem::isEditing() { return MenuRenderer::isAnyEditing(); }
+void MenuItem::beginEdit() { MenuRenderer::sharedEditing = true; }
+void MenuItem::endEdit() { MenuRenderer::sharedEditing = false; }
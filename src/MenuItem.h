@@ -27,14 +27,16 @@
 #ifndef MenuItem_H
 #define MenuItem_H
 
-#define ITEM_DRAW_BUFFER_SIZE 25
-
+#include "LcdMenuConfig.h"
+#include "diagnostics/MemoryReport.h"
 #include "renderer/MenuRenderer.h"
 #include "utils/lcd_menu_constants.h"
+#include <utils/lcd_menu_text.h>
 #include <utils/lcd_menu_utils.h>
 
 class LcdMenu;
 class MenuScreen;
+class BaseWidget;
 
 /**
  * @class MenuItem
@@ -50,41 +52,111 @@ class MenuItem {
     friend MenuScreen;
 
   protected:
-    const char* text = NULL;
+    MenuText text;
     bool polling = false;
-
-    static bool _isEditing;
+    /**
+     * @brief Incremented by `markDirty`, renderers that drew an older revision redraw the item.
+     */
+    uint8_t revision = 0;
+    /**
+     * @brief Milliseconds between two polls, `0` for the interval given to `LcdMenu::poll`.
+     */
+    uint16_t pollInterval = 0;
 
   public:
+    /**
+     * @brief Check if an item is being edited on any menu.
+     * Each menu has its own edit state, prefer `LcdMenu::isEditing`.
+     */
     static bool isEditing();
-    static void beginEdit();
-    static void endEdit();
-    MenuItem(const char* text) : text(text) {}
+    /**
+     * @brief Start an edit seen by every menu, as before each menu had its own edit state.
+     * @deprecated Call `beginEdit` on the renderer given to `process`, `menu->getRenderer()->beginEdit()`.
+     */
+    __attribute__((deprecated("use menu->getRenderer()->beginEdit()"))) static void beginEdit();
+    /**
+     * @brief Stop the edit started by `MenuItem::beginEdit`.
+     * @deprecated Call `endEdit` on the renderer, `menu->getRenderer()->endEdit()`.
+     */
+    __attribute__((deprecated("use menu->getRenderer()->endEdit()"))) static void endEdit();
+    MenuItem(MenuText text) : text(text) {}
     /**
      * @brief Get the text of the item
-     * @return `String` - Item's text
+     * @return `String` - Item's text, an address in flash if `isTextInFlash`
      */
     const char* getText() {
-        return text;
+        return text.text;
+    }
+    /**
+     * @brief Check if the text was given with `F("...")`.
+     */
+    bool isTextInFlash() const {
+        return text.inFlash;
+    }
+    /**
+     * @brief Print the text of the item, wherever it is stored.
+     */
+    size_t printText(Print& out) const {
+        return text.printTo(out);
     }
     /**
      * @brief Set the text of the item
      * @note You need to call `LcdMenu::refresh` after this method to see the changes.
-     * @param text text to display for the item
+     * @param text text to display for the item, in RAM or in flash
      */
-    void setText(const char* text) {
+    void setText(MenuText text) {
         this->text = text;
     };
 
+    /**
+     * @brief Poll the item every `interval` milliseconds, whatever interval is given to `LcdMenu::poll`.
+     * The item is polled from then on.
+     * @param interval the interval, `0` to use the one given to `LcdMenu::poll`
+     */
+    void setPollInterval(uint16_t interval) {
+        polling = true;
+        pollInterval = interval;
+    }
+    uint16_t getPollInterval() const { return pollInterval; }
+    /**
+     * @brief Redraw the item on the next `LcdMenu::poll` of every menu it is visible on, whatever its poll interval.
+     * Called by `ObservableValue::set` for the items observing the value.
+     */
+    void markDirty() { revision++; }
+
     /**
      * @brief Check if the item can be selected by the cursor.
      */
     virtual bool isSelectable() const { return true; }
 
+#if LCDMENU_WIDGETS
+    /**
+     * @brief Get the widget at `index`.
+     * @return the widget, `nullptr` if the item has no widget at `index`
+     */
+    virtual BaseWidget* getWidgetAt(const uint8_t /*index*/) const { return nullptr; }
+#endif
+
+    /**
+     * @brief Add the memory taken by this item to the report.
+     * Items with their own fields, buffers or widgets override this.
+     * @param report the report to add to
+     */
+    virtual void report(MemoryReport& report) {
+        reportItem(report, sizeof(*this));
+    }
+
     // Destructor
     virtual ~MenuItem() noexcept = default;
 
   protected:
+    /**
+     * @brief Add an item of `size` bytes and its text to the report.
+     */
+    void reportItem(MemoryReport& report, size_t size) const {
+        report.add(MemoryReport::ITEM, size);
+        report.addText(text);
+    }
     /**
      * @brief The number of available columns for the potential value of the item.
      *
@@ -99,7 +171,7 @@ class MenuItem {
      * Effectively const, but initialized lately when renderer is injected.
      */
     inline uint8_t getViewSize(MenuRenderer* renderer) const {
-        return renderer->getEffectiveCols() - strlen(text) - 1 + renderer->viewShift;
+        return renderer->getEffectiveCols() - text.drawnLength() - 1 + renderer->viewShift;
     };
     /**
      * @brief Process a command decoded in 1 byte.
@@ -122,6 +194,15 @@ class MenuItem {
     virtual void draw(MenuRenderer* renderer) {
         renderer->drawItem(text, NULL);
     };
+    /**
+     * @brief Redraw this menu item on the row where it is already shown.
+     * Used by `LcdMenu::poll` and `LcdMenu::refreshDirty`, items that can redraw
+     * part of their row override it, the others draw the whole row.
+     * @param renderer The renderer to use for drawing.
+     */
+    virtual void update(MenuRenderer* renderer) {
+        draw(renderer);
+    };
 };
 
 #define ITEM_BASIC(...) (new MenuItem(__VA_ARGS__))
@@ -8,6 +8,10 @@ uint8_t MenuScreen::getCursor() {
     return cursor;
 }
 
+uint8_t MenuScreen::getView() {
+    return view;
+}
+
 MenuItem* MenuScreen::getItemAt(uint8_t position) {
     return items[position];
 }
@@ -16,6 +20,13 @@ MenuItem* MenuScreen::operator[](const uint8_t position) {
     return getItemAt(position);
 }
 
+void MenuScreen::report(MemoryReport& report) {
+    report.add(MemoryReport::SCREEN, sizeof(MenuScreen) + items.capacity() * sizeof(MenuItem*));
+    for (MenuItem* item : items) {
+        item->report(report);
+    }
+}
+
 void MenuScreen::setCursor(MenuRenderer* renderer, uint8_t position) {
     if (items.empty()) {
         cursor = 0;
@@ -52,14 +63,69 @@ void MenuScreen::setCursor(MenuRenderer* renderer, uint8_t position) {
 }
 
 void MenuScreen::draw(MenuRenderer* renderer) {
-    for (uint8_t i = 0; i < renderer->maxRows && i < items.size(); i++) {
+    for (uint8_t i = 0; i < renderer->maxRows && (view + i) < items.size(); i++) {
         MenuItem* item = this->items[view + i];
         if (item == nullptr) {
             break;
         }
-        syncIndicators(i, renderer);
+        drawRow(i, renderer);
+    }
+    markUntrackedDrawn(renderer);
+}
+
+void MenuScreen::drawRow(uint8_t index, MenuRenderer* renderer, bool inPlace) {
+    MenuItem* item = this->items[view + index];
+    syncIndicators(index, renderer);
+    RenderProfiler::Scope scope(renderer->profiler, item, RenderProfiler::DRAW);
+    if (inPlace) {
+        item->update(renderer);
+    } else {
         item->draw(renderer);
     }
+    if (index < POLL_MAX_ROWS) {
+        renderer->drawnRevisions[index] = item->revision;
+        // The item now in the row starts its own interval, not the one of the item it replaced
+        renderer->lastPollTimes[index] = renderer->clock->now();
+    }
+}
+
+bool MenuScreen::isDirty(uint8_t index, MenuRenderer* renderer) {
+    if (index >= POLL_MAX_ROWS) return renderer->drawnRevisions[POLL_MAX_ROWS] != untrackedRevision(renderer);
+    return renderer->drawnRevisions[index] != items[view + index]->revision;
+}
+
+uint8_t MenuScreen::untrackedRevision(MenuRenderer* renderer) {
+    uint8_t sum = 0;
+    for (uint8_t i = POLL_MAX_ROWS; i < renderer->maxRows && (view + i) < items.size(); i++) {
+        MenuItem* item = this->items[view + i];
+        if (item == nullptr) break;
+        sum += item->revision;
+    }
+    return sum;
+}
+
+void MenuScreen::drawUntracked(MenuRenderer* renderer) {
+    bool dirty = isDirty(POLL_MAX_ROWS, renderer);
+    for (uint8_t i = POLL_MAX_ROWS; i < renderer->maxRows && (view + i) < items.size(); i++) {
+        MenuItem* item = this->items[view + i];
+        if (item == nullptr) break;
+        if (dirty || item->polling) drawRow(i, renderer, true);
+    }
+    markUntrackedDrawn(renderer);
+}
+
+void MenuScreen::markUntrackedDrawn(MenuRenderer* renderer) {
+    renderer->drawnRevisions[POLL_MAX_ROWS] = untrackedRevision(renderer);
+    renderer->lastPollTimes[POLL_MAX_ROWS] = renderer->clock->now();
+}
+
+void MenuScreen::drawDirty(MenuRenderer* renderer) {
+    for (uint8_t i = 0; i < renderer->maxRows && i < POLL_MAX_ROWS && (view + i) < items.size(); i++) {
+        MenuItem* item = this->items[view + i];
+        if (item == nullptr || !isDirty(i, renderer)) continue;
+        drawRow(i, renderer, true);
+    }
+    if (renderer->maxRows > POLL_MAX_ROWS && isDirty(POLL_MAX_ROWS, renderer)) drawUntracked(renderer);
 }
 
 void MenuScreen::syncIndicators(uint8_t index, MenuRenderer* renderer) {
@@ -72,23 +138,34 @@ void MenuScreen::syncIndicators(uint8_t index, MenuRenderer* renderer) {
 bool MenuScreen::process(LcdMenu* menu, const unsigned char command) {
     MenuRenderer* renderer = menu->getRenderer();
     syncIndicators(cursor - view, renderer);
-    if (items[cursor]->process(menu, command)) return true;
+    // An item edited on another renderer keeps its edit, this renderer only navigates past it
+    if (!items.empty() && (renderer->isEditing() || MenuRenderer::findEditor(items[cursor], renderer) == NULL)) {
+        RenderProfiler::Scope scope(renderer->profiler, items[cursor], RenderProfiler::PROCESS);
+        bool handled = items[cursor]->process(menu, command);
+        if (renderer->editing && renderer->editedItem == NULL) renderer->editedItem = items[cursor];
+        if (handled) return true;
+    }
     switch (command) {
         case UP:
+#if LCDMENU_VIEW_SHIFT
             renderer->viewShift = 0;
+#endif
             up(renderer);
             return true;
         case DOWN:
+#if LCDMENU_VIEW_SHIFT
             renderer->viewShift = 0;
+#endif
             down(renderer);
             return true;
         case BACK:
+#if LCDMENU_VIEW_SHIFT
             renderer->viewShift = 0;
-            if (parent != NULL) {
-                menu->setScreen(parent);
-            }
+#endif
+            menu->back();
             LOG(F("MenuScreen::back"));
             return true;
+#if LCDMENU_VIEW_SHIFT
         case RIGHT:
             if (renderer->cursorCol >= renderer->maxCols - 1) {
                 renderer->viewShift++;
@@ -103,6 +180,7 @@ bool MenuScreen::process(LcdMenu* menu, const unsigned char command) {
             }
             LOG(F("MenuScreen::left"), renderer->viewShift);
             return true;
+#endif
         default:
             return false;
     }
@@ -148,8 +226,46 @@ void MenuScreen::reset(MenuRenderer* renderer) {
     }
 }
 
+void MenuScreen::restore(MenuRenderer* renderer, uint8_t cursor, uint8_t view) {
+    if (cursor >= items.size() || cursor < view || cursor >= view + renderer->maxRows ||
+        !items[cursor]->isSelectable()) {
+        reset(renderer);
+        return;
+    }
+    this->cursor = cursor;
+    this->view = view;
+    draw(renderer);
+}
+
+void MenuScreen::clearEmptyRows(MenuRenderer* renderer) {
+    uint8_t used = items.size() > view ? items.size() - view : 0;
+    for (uint8_t i = used; i < renderer->maxRows; i++) {
+        clearRow(i, renderer);
+    }
+}
+
+void MenuScreen::clearRow(uint8_t index, MenuRenderer* renderer) {
+    renderer->hasHiddenItemsAbove = false;
+    renderer->hasHiddenItemsBelow = false;
+    renderer->hasFocus = false;
+    renderer->cursorRow = index;
+    renderer->drawItem("", NULL);
+}
+
+void MenuScreen::drawRows(MenuRenderer* renderer, uint8_t first, uint8_t count) {
+    for (uint8_t i = first; i < first + count && i < renderer->maxRows; i++) {
+        if (view + i < items.size() && items[view + i] != nullptr) {
+            drawRow(i, renderer);
+        } else {
+            clearRow(i, renderer);
+        }
+    }
+    if (first <= POLL_MAX_ROWS && first + count >= renderer->maxRows) markUntrackedDrawn(renderer);
+}
+
 MenuScreen::MenuScreen(const std::vector<MenuItem*>& items) : items(items) {}
 
+#if LCDMENU_DYNAMIC_SCREENS
 void MenuScreen::addItem(MenuItem* item) {
     items.push_back(item);
 }
@@ -175,16 +291,40 @@ void MenuScreen::removeLastItem() {
 void MenuScreen::clear() {
     items.clear();
 }
+#endif
 
 void MenuScreen::poll(MenuRenderer* renderer, uint16_t pollInterval) {
-    static unsigned long lastPollTime = 0;
-    if (millis() - lastPollTime >= pollInterval) {
+    if (renderer->isEditing()) return;
+    unsigned long now = renderer->clock->now();
+    for (uint8_t drawn = 0; drawn < POLL_ROWS_PER_TICK; drawn++) {
+        // Redraw the dirty rows first, then the row that is the most overdue
+        int8_t next = -1;
+        unsigned long lateness = 0;
         for (uint8_t i = 0; i < renderer->maxRows && (view + i) < items.size(); i++) {
             MenuItem* item = this->items[view + i];
-            if (item == nullptr || !item->polling || MenuItem::isEditing()) continue;
-            syncIndicators(i, renderer);
-            item->draw(renderer);
+            if (item == nullptr) continue;
+            unsigned long late;
+            if (isDirty(i, renderer)) {
+                late = (unsigned long)-1;
+            } else {
+                if (!item->polling) continue;
+                // Rows past the tracked ones share a poll time, at the menu's interval
+                bool tracked = i < POLL_MAX_ROWS;
+                unsigned long interval = tracked && item->pollInterval != 0 ? item->pollInterval : pollInterval;
+                unsigned long elapsed = now - renderer->lastPollTimes[tracked ? i : POLL_MAX_ROWS];
+                if (elapsed < interval) continue;
+                late = elapsed - interval;
+            }
+            if (next < 0 || late > lateness) {
+                next = i;
+                lateness = late;
+            }
+        }
+        if (next < 0) return;
+        if (next < POLL_MAX_ROWS) {
+            drawRow(next, renderer, true);
+        } else {
+            drawUntracked(renderer);
         }
-        lastPollTime = millis();
     }
 }
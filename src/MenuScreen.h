@@ -1,6 +1,7 @@
 #pragma once
 
 #include "LcdMenu.h"
+#include "LcdMenuConfig.h"
 #include "MenuItem.h"
 #include "renderer/MenuRenderer.h"
 #include "utils/lcd_menu_constants.h"
@@ -82,6 +83,10 @@ class MenuScreen {
      * @brief Get current cursor position.
      */
     uint8_t getCursor();
+    /**
+     * @brief Get the index of the first visible item.
+     */
+    uint8_t getView();
     /**
      * @brief Get a `MenuItem` at position.
      * @return `MenuItem` - item at `position`
@@ -92,6 +97,7 @@ class MenuScreen {
      * @return `MenuItem` - item at `position`
      */
     MenuItem* operator[](const uint8_t position);
+#if LCDMENU_DYNAMIC_SCREENS
     /**
      * @brief Add a new item to the menu.
      */
@@ -115,11 +121,18 @@ class MenuScreen {
      * @brief Clear all items from the menu.
      */
     void clear();
+#endif
 
     /**
      * @brief Get the number of items in the menu.
      */
     const size_t size() { return items.size(); }
+    /**
+     * @brief Add the memory taken by this screen and its items to the report.
+     * Screens opened by submenu items are not followed, report them separately.
+     * @param report the report to add to
+     */
+    void report(MemoryReport& report);
 
   protected:
     /**
@@ -131,12 +144,35 @@ class MenuScreen {
      * @param renderer The renderer to use for drawing.
      */
     void draw(MenuRenderer* renderer);
+    /**
+     * @brief Draw the visible item on row `index`, the item must not be `nullptr`.
+     * @param inPlace whether the row already shows the item, see `MenuItem::update`
+     */
+    void drawRow(uint8_t index, MenuRenderer* renderer, bool inPlace = false);
+    /**
+     * @brief Check if the item on row `index` changed since `renderer` drew it.
+     * Rows past `POLL_MAX_ROWS` are dirty together, when any of their items changed.
+     */
+    bool isDirty(uint8_t index, MenuRenderer* renderer);
+    /**
+     * @brief Sum of the revisions of the visible items past `POLL_MAX_ROWS`.
+     */
+    uint8_t untrackedRevision(MenuRenderer* renderer);
+    /**
+     * @brief Redraw the rows past `POLL_MAX_ROWS` that are polled, or all of them when they are dirty.
+     */
+    void drawUntracked(MenuRenderer* renderer);
+    /**
+     * @brief Record that the rows past `POLL_MAX_ROWS` were drawn now.
+     */
+    void markUntrackedDrawn(MenuRenderer* renderer);
     /**
      * @brief Sync indicators with the renderer.
      */
     void syncIndicators(uint8_t index, MenuRenderer* renderer);
     /**
      * @brief Process the command.
+     * The focused item is skipped while another renderer is editing it, see `MenuRenderer::findEditor`.
      * @return `true` if the command was processed, `false` otherwise.
      */
     bool process(LcdMenu* menu, const unsigned char command);
@@ -152,12 +188,37 @@ class MenuScreen {
      * @brief Reset the screen to initial state.
      */
     void reset(MenuRenderer* renderer);
+    /**
+     * @brief Move the cursor and view back to where the screen was left, then draw it.
+     * Resets the screen if that position is not valid any more.
+     */
+    void restore(MenuRenderer* renderer, uint8_t cursor, uint8_t view);
+    /**
+     * @brief Blank the rows below the last item, used when the display is not cleared before drawing.
+     */
+    void clearEmptyRows(MenuRenderer* renderer);
+    /**
+     * @brief Blank row `index`.
+     */
+    void clearRow(uint8_t index, MenuRenderer* renderer);
+    /**
+     * @brief Draw `count` rows from row `first` again, blanking the rows without an item.
+     * Used to restore what a message covered, see `LcdMenu::showOverlay`.
+     */
+    void drawRows(MenuRenderer* renderer, uint8_t first, uint8_t count);
     /**
      * @brief Poll the screen for changes.
+     * Redraws at most `POLL_ROWS_PER_TICK` visible items that are dirty or
+     * polled and due, dirty items first, then the most overdue. The rows past
+     * `POLL_MAX_ROWS` count as one, polled at `pollInterval`.
      * @param renderer The renderer to use for drawing.
-     * @param pollInterval The interval to poll the screen.
+     * @param pollInterval The interval of items without their own, see `MenuItem::setPollInterval`.
      */
     void poll(MenuRenderer* renderer, uint16_t pollInterval);
+    /**
+     * @brief Redraw the visible items marked dirty, see `MenuItem::markDirty`.
+     */
+    void drawDirty(MenuRenderer* renderer);
 };
 
 #define MENU_SCREEN(screen, items, ...)           \
@@ -0,0 +1,30 @@
+#include "ObservableValue.h"
+#include "LcdMenu.h"
+
+bool Observable::observe(MenuItem* item) {
+    for (uint8_t i = 0; i < OBSERVABLE_VALUE_OBSERVERS; i++) {
+        if (observers[i] == item) return true;
+        if (observers[i] == NULL) {
+            observers[i] = item;
+            return true;
+        }
+    }
+    return false;
+}
+
+void Observable::unobserve(MenuItem* item) {
+    for (uint8_t i = 0; i < OBSERVABLE_VALUE_OBSERVERS; i++) {
+        if (observers[i] != item) continue;
+        // Keep the observers packed, `notify` stops at the first empty slot
+        for (; i + 1 < OBSERVABLE_VALUE_OBSERVERS; i++) observers[i] = observers[i + 1];
+        observers[OBSERVABLE_VALUE_OBSERVERS - 1] = NULL;
+        return;
+    }
+}
+
+void Observable::notify() {
+    for (uint8_t i = 0; i < OBSERVABLE_VALUE_OBSERVERS && observers[i] != NULL; i++) {
+        observers[i]->markDirty();
+    }
+    if (menu != NULL) menu->refreshDirty();
+}
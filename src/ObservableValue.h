@@ -0,0 +1,92 @@
+#pragma once
+
+#include "MenuItem.h"
+
+/**
+ * Number of items that can observe one value, further items bound to it are polled.
+ */
+#ifndef OBSERVABLE_VALUE_OBSERVERS
+#define OBSERVABLE_VALUE_OBSERVERS 2
+#endif
+
+class LcdMenu;
+
+/**
+ * @class Observable
+ * @brief Items to redraw when a value changes, see `ObservableValue`.
+ */
+class Observable {
+  private:
+    MenuItem* observers[OBSERVABLE_VALUE_OBSERVERS] = {};
+    LcdMenu* menu = NULL;
+
+  protected:
+    /**
+     * @brief Mark the observers dirty, and redraw them now in synchronous mode.
+     */
+    void notify();
+
+  public:
+    /**
+     * @brief Mark `item` dirty whenever the value changes.
+     * @return `false` if there are already `OBSERVABLE_VALUE_OBSERVERS` observers
+     */
+    bool observe(MenuItem* item);
+    /**
+     * @brief Stop marking `item` dirty, called by the items bound to the value when they are deleted.
+     */
+    void unobserve(MenuItem* item);
+    /**
+     * @brief Redraw the observers on `menu` as soon as the value changes,
+     * instead of on the next `LcdMenu::poll`.
+     * @param menu the menu to redraw, `NULL` to wait for `poll` again
+     */
+    void setSynchronous(LcdMenu* menu) { this->menu = menu; }
+};
+
+/**
+ * @class ObservableValue
+ * @brief A value that tells the items showing it when it changes.
+ *
+ * Items bound to a polled reference format their value on every poll to
+ * find out whether it changed. Items bound to an `ObservableValue` are not
+ * polled: `set` marks them dirty and `LcdMenu::poll` redraws only them, or
+ * `set` redraws them right away after `setSynchronous`.
+ *
+ * @example
+ *   ObservableValue<float> temperature(20.0f);
+ *   MenuItem* item = ITEM_VALUE("Temp", temperature, "%.1f");
+ *   ...
+ *   void onSensor(float value) {
+ *       temperature.set(value);
+ *   }
+ *   void loop() {
+ *       menu.poll();
+ *   }
+ *
+ * @tparam T the type of the value, compared with `!=`
+ */
+template <typename T>
+class ObservableValue : public Observable {
+    template <typename>
+    friend class ItemValue;
+    template <typename, typename>
+    friend class ItemBar;
+
+  private:
+    T value;
+
+  public:
+    ObservableValue(const T& value = T()) : value(value) {}
+
+    const T& get() const { return value; }
+    /**
+     * @brief Set the value and mark its observers dirty if it changed.
+     */
+    void set(const T& newValue) {
+        if (value != newValue) {
+            value = newValue;
+            notify();
+        }
+    }
+};
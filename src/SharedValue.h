@@ -0,0 +1,96 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Orders the accesses of `SharedValue` for the compiler, and for the
+ * other core on dual-core boards.
+ *
+ * The sequence number is 16-bit: a `load` would only accept a torn copy if
+ * exactly a multiple of 65536 values were stored while it copied one.
+ * On AVR the sequence is read in two halves, a store between them makes
+ * the read disagree with the check that follows and `load` tries again.
+ */
+#if defined(__AVR__)
+#define SHARED_VALUE_BARRIER() __asm__ __volatile__("" ::: "memory")
+#else
+#define SHARED_VALUE_BARRIER() __sync_synchronize()
+#endif
+
+/**
+ * @class SharedValue
+ * @brief A value written by a task or an ISR and read by the menu without tearing.
+ *
+ * Values of more than one byte, such as `float` or `uint32_t` on AVR, are
+ * not written in one instruction. A menu reading such a value through a
+ * reference while a task writes it can show half of the old value and half
+ * of the new one.
+ *
+ * `SharedValue` keeps two copies. `store` writes the copy that is not being
+ * read, then publishes it by incrementing a 16-bit sequence number.
+ * `load` copies the published value and tries again only if a newer value
+ * was published in the meantime. Neither side takes a lock or disables
+ * interrupts, and a writer stopped in the middle of `store` never holds up
+ * `load`.
+ *
+ * There must be one writer at a time: a task or an ISR, or the menu when the
+ * value is edited. Any number of readers are allowed.
+ *
+ * Items take a `SharedValue` where they take a reference: `ITEM_VALUE`,
+ * `ITEM_RANGE_REF` and `WIDGET_RANGE_REF`.
+ *
+ * @example
+ *   SharedValue<float> temperature(20.0f);
+ *   MenuItem* item = ITEM_VALUE("Temp", temperature, "%.1f");
+ *   ...
+ *   void sensorTask(void*) {
+ *       for (;;) temperature.store(readSensor());
+ *   }
+ *
+ * @tparam T the type of the value, copied with `=`
+ */
+template <typename T>
+class SharedValue {
+  private:
+    T slots[2];
+    /**
+     * @brief Number of completed writes, `slots[sequence & 1]` is the latest value.
+     */
+    volatile uint16_t sequence = 0;
+
+  public:
+    SharedValue(const T& value = T()) : slots{value, value} {}
+
+    /**
+     * @brief Publish a new value, never waits.
+     */
+    void store(const T& value) {
+        uint16_t next = sequence + 1;
+        slots[next & 1] = value;
+        SHARED_VALUE_BARRIER();
+        sequence = next;
+    }
+
+    /**
+     * @brief Get a consistent copy of the latest value.
+     */
+    T load() const {
+        while (true) {
+            uint16_t published = sequence;
+            SHARED_VALUE_BARRIER();
+            T value = slots[published & 1];
+            SHARED_VALUE_BARRIER();
+            // The slot is only written again after the next value is published
+            if (sequence == published) return value;
+        }
+    }
+};
+
+/**
+ * @brief The value to draw for `value`: the value itself, or a copy of a `SharedValue`.
+ */
+template <typename T>
+inline const T& snapshot(const T& value) { return value; }
+
+template <typename T>
+inline T snapshot(const SharedValue<T>& value) { return value.load(); }
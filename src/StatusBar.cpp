@@ -0,0 +1,78 @@
+#include "StatusBar.h"
+
+int8_t StatusBar::addField(uint8_t col, uint8_t width, StatusFieldDrawer drawer, uint16_t interval) {
+    uint8_t cols = menu->getRenderer()->getMaxCols();
+    if (cols > STATUS_BAR_COLS) cols = STATUS_BAR_COLS;
+    if (fieldCount == STATUS_BAR_FIELDS || col >= cols || drawer == NULL) {
+        return -1;
+    }
+    if (width > cols - col) width = cols - col;
+    fields[fieldCount] = {drawer, 0, interval, col, width, true};
+    return fieldCount++;
+}
+
+void StatusBar::markDirty(uint8_t field) {
+    if (field < fieldCount) fields[field].dirty = true;
+}
+
+void StatusBar::redraw() {
+    memset(cells, 0, sizeof(cells));
+    for (uint8_t i = 0; i < fieldCount; i++) {
+        fields[i].dirty = true;
+    }
+}
+
+void StatusBar::update() {
+    MenuRenderer* renderer = menu->getRenderer();
+    if (!menu->isEnabled()) {
+        shown = false;
+        return;
+    }
+    if (renderer->getPowerState() == MenuRenderer::OFF) {
+        return;
+    }
+    if (!shown) {
+        shown = true;
+        redraw();
+    }
+    unsigned long now = menu->getClock()->now();
+    bool drawn = false;
+    for (uint8_t i = 0; i < fieldCount; i++) {
+        Field& field = fields[i];
+        if (field.dirty || (field.interval != 0 && now - field.lastUpdate >= field.interval)) {
+            drawn |= drawField(field, now);
+        }
+    }
+    // Put the cursor back on the item being edited
+    if (drawn && renderer->isEditing()) {
+        renderer->moveCursor(renderer->getCursorCol(), renderer->getCursorRow());
+    }
+}
+
+bool StatusBar::drawField(Field& field, unsigned long now) {
+    char buffer[STATUS_BAR_COLS + 1] = {};
+    field.drawer(buffer, field.width);
+    field.dirty = false;
+    field.lastUpdate = now;
+    DisplayInterface* display = menu->getRenderer()->display;
+    bool drawn = false;
+    bool padding = false;
+    bool seek = true;
+    for (uint8_t i = 0; i < field.width; i++) {
+        padding |= buffer[i] == '\0';
+        char c = padding ? ' ' : buffer[i];
+        uint8_t col = field.col + i;
+        if (cells[col] == c) {
+            seek = true;
+            continue;
+        }
+        if (seek) {
+            display->setCursor(col, row);
+            seek = false;
+        }
+        display->draw(static_cast<uint8_t>(c));
+        cells[col] = c;
+        drawn = true;
+    }
+    return drawn;
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "LcdMenu.h"
+
+/**
+ * Number of fields of a `StatusBar`.
+ */
+#ifndef STATUS_BAR_FIELDS
+#define STATUS_BAR_FIELDS 4
+#endif
+
+/**
+ * Widest row a `StatusBar` can keep a copy of.
+ */
+#ifndef STATUS_BAR_COLS
+#define STATUS_BAR_COLS 20
+#endif
+
+/**
+ * @brief Writes the text of a status bar field.
+ * @param buffer receives the text, at most `width` characters, shorter texts are padded with blanks
+ * @param width the width of the field
+ */
+typedef void (*StatusFieldDrawer)(char* buffer, uint8_t width);
+
+/**
+ * @class StatusBar
+ * @brief A row outside the menu showing fields updated at their own rate.
+ *
+ * Each field covers `width` cells of the row and is drawn again every
+ * `interval` milliseconds, or on the next `update` after `markDirty`. Only
+ * the cells whose character changed are sent to the display, the menu rows
+ * are never touched. Give the menu the other rows with
+ * `MenuRenderer::setViewport`.
+ *
+ * Nothing is drawn while the menu is hidden, the whole row is drawn again
+ * once it is shown.
+ *
+ * @example
+ *   StatusBar status(&menu, 0);
+ *   void drawClock(char* buffer, uint8_t width) {
+ *       snprintf(buffer, width + 1, "%02d:%02d", hours, minutes);
+ *   }
+ *   void setup() {
+ *       renderer.setViewport(1, 3);
+ *       status.addField(0, 5, drawClock, 1000);
+ *       ...
+ *   }
+ *   void loop() {
+ *       status.update();
+ *   }
+ */
+class StatusBar {
+  private:
+    struct Field {
+        StatusFieldDrawer drawer;
+        unsigned long lastUpdate;
+        uint16_t interval;
+        uint8_t col;
+        uint8_t width;
+        bool dirty;
+    };
+
+    LcdMenu* menu;
+    const uint8_t row;
+    Field fields[STATUS_BAR_FIELDS];
+    uint8_t fieldCount = 0;
+    /**
+     * @brief Characters on the display, `0` where unknown.
+     */
+    char cells[STATUS_BAR_COLS] = {};
+    /**
+     * @brief The menu was shown on the last `update`.
+     */
+    bool shown = false;
+
+    /**
+     * @brief Draw the cells of `field` that changed.
+     * @return `true` if something was sent to the display
+     */
+    bool drawField(Field& field, unsigned long now);
+
+  public:
+    /**
+     * @param menu the menu whose display and clock are used
+     * @param row the row of the display to draw on
+     */
+    StatusBar(LcdMenu* menu, uint8_t row = 0) : menu(menu), row(row) {}
+
+    /**
+     * @brief Add a field covering `width` cells from `col`.
+     * @param col the first column of the field
+     * @param width the number of columns, cut to the width of the display
+     * @param drawer writes the text of the field
+     * @param interval milliseconds between two updates, `0` to update only after `markDirty`
+     * @return the index of the field, `-1` if there are already `STATUS_BAR_FIELDS` fields
+     */
+    int8_t addField(uint8_t col, uint8_t width, StatusFieldDrawer drawer, uint16_t interval = 1000);
+    /**
+     * @brief Update the field on the next `update`, whatever its interval.
+     * @param field the index returned by `addField`
+     */
+    void markDirty(uint8_t field);
+    /**
+     * @brief Draw every field again, for example after drawing over the row.
+     */
+    void redraw();
+    /**
+     * @brief Update the fields that are due. Call it in `loop()`.
+     * Nothing is drawn while the menu is hidden or the display is off.
+     */
+    void update();
+};
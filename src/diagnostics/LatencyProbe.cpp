@@ -0,0 +1,110 @@
+#include "LatencyProbe.h"
+#include "MenuItem.h"
+
+// Upper limits of the buckets in milliseconds, the last bucket is open
+static const uint16_t bucketLimits[LatencyProbe::BUCKET_COUNT - 1] = {1, 2, 5, 10, 20, 50, 100};
+
+static const __FlashStringHelper* commandName(LatencyProbe::Command command) {
+    switch (command) {
+        case LatencyProbe::CMD_UP:
+            return F("UP");
+        case LatencyProbe::CMD_DOWN:
+            return F("DOWN");
+        case LatencyProbe::CMD_LEFT:
+            return F("LEFT");
+        case LatencyProbe::CMD_RIGHT:
+            return F("RIGHT");
+        case LatencyProbe::CMD_ENTER:
+            return F("ENTER");
+        case LatencyProbe::CMD_BACK:
+            return F("BACK");
+        case LatencyProbe::CMD_PRINTABLE:
+            return F("PRINTABLE");
+        default:
+            return F("OTHER");
+    }
+}
+
+LatencyProbe::Command LatencyProbe::classify(const unsigned char command) {
+    switch (command) {
+        case UP:
+            return CMD_UP;
+        case DOWN:
+            return CMD_DOWN;
+        case LEFT:
+            return CMD_LEFT;
+        case RIGHT:
+            return CMD_RIGHT;
+        case ENTER:
+            return CMD_ENTER;
+        case BACK:
+            return CMD_BACK;
+        default:
+            return isprint(command) ? CMD_PRINTABLE : CMD_OTHER;
+    }
+}
+
+uint16_t LatencyProbe::getBucketLimit(uint8_t bucket) {
+    return bucket < BUCKET_COUNT - 1 ? bucketLimits[bucket] : 0;
+}
+
+void LatencyProbe::begin(const unsigned char command, MenuItem* item) {
+    unsigned long now = micros();
+    if (pending) close(now);
+    this->command = classify(command);
+    this->item = item;
+    startMicros = now;
+    pending = true;
+}
+
+void LatencyProbe::end() {
+    if (pending) close(micros());
+}
+
+void LatencyProbe::close(unsigned long now) {
+    pending = false;
+    unsigned long elapsed = now - startMicros;
+    unsigned long elapsedMs = elapsed / 1000;
+    Stats& s = stats[command];
+    uint8_t bucket = 0;
+    while (bucket < BUCKET_COUNT - 1 && elapsedMs >= bucketLimits[bucket]) {
+        bucket++;
+    }
+    if (s.buckets[bucket] < 0xFFFF) s.buckets[bucket]++;
+    if (s.count < 0xFFFF) s.count++;
+    if (elapsedMs >= LATENCY_BUDGET_MS && s.overBudget < 0xFFFF) s.overBudget++;
+    if (elapsed >= s.maxMicros) {
+        s.maxMicros = elapsed;
+        s.slowestItem = item;
+    }
+}
+
+void LatencyProbe::clear() {
+    memset(stats, 0, sizeof(stats));
+    pending = false;
+}
+
+void LatencyProbe::printTo(Print& out) const {
+    for (uint8_t c = 0; c < COMMAND_COUNT; c++) {
+        const Stats& s = stats[c];
+        if (s.count == 0) continue;
+        out.print(commandName((Command)c));
+        out.print(F(": n="));
+        out.print((unsigned long)s.count);
+        out.print(F(" max="));
+        out.print(s.maxMicros);
+        out.print(F("us over="));
+        out.print((unsigned long)s.overBudget);
+        out.print(F(" ["));
+        for (uint8_t b = 0; b < BUCKET_COUNT; b++) {
+            if (b > 0) out.print(' ');
+            out.print((unsigned long)s.buckets[b]);
+        }
+        out.print(']');
+        if (s.slowestItem != NULL && s.slowestItem->getText() != NULL) {
+            out.print(F(" slowest="));
+            s.slowestItem->printText(out);
+        }
+        out.println();
+    }
+}
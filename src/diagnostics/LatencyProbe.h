@@ -0,0 +1,102 @@
+#pragma once
+
+#include <Arduino.h>
+
+class MenuItem;
+
+/**
+ * Commands that take longer than this, in milliseconds, are counted as over budget.
+ */
+#ifndef LATENCY_BUDGET_MS
+#define LATENCY_BUDGET_MS 50
+#endif
+
+/**
+ * @class LatencyProbe
+ * @brief Measures the time from a command entering `LcdMenu::process` until
+ *        the display writes it caused are complete.
+ *
+ * Keeps a histogram, the maximum latency and the slowest item per command
+ * type. Attach it with `LcdMenu::setLatencyProbe`.
+ *
+ * The writes are complete when `LcdMenu::process` returns.
+ *
+ * @example
+ *   LatencyProbe probe;
+ *   menu.setLatencyProbe(&probe);
+ *   ...
+ *   probe.printTo(Serial);
+ */
+class LatencyProbe {
+  public:
+    enum Command : uint8_t {
+        CMD_UP,
+        CMD_DOWN,
+        CMD_LEFT,
+        CMD_RIGHT,
+        CMD_ENTER,
+        CMD_BACK,
+        CMD_PRINTABLE,
+        CMD_OTHER,
+        COMMAND_COUNT
+    };
+
+    /**
+     * Number of histogram buckets, see `getBucketLimit`.
+     */
+    static const uint8_t BUCKET_COUNT = 8;
+
+    struct Stats {
+        uint16_t buckets[BUCKET_COUNT];
+        uint16_t count;
+        uint16_t overBudget;
+        unsigned long maxMicros;
+        /**
+         * @brief Item under the cursor when the slowest command was received.
+         */
+        MenuItem* slowestItem;
+    };
+
+  private:
+    Stats stats[COMMAND_COUNT] = {};
+    bool pending = false;
+    Command command = CMD_OTHER;
+    MenuItem* item = NULL;
+    unsigned long startMicros = 0;
+
+    void close(unsigned long now);
+
+  public:
+    /**
+     * @brief Type of a command received by the menu.
+     */
+    static Command classify(const unsigned char command);
+    /**
+     * @brief Upper limit of a bucket in milliseconds, exclusive.
+     * The last bucket has no upper limit and returns 0.
+     */
+    static uint16_t getBucketLimit(uint8_t bucket);
+    /**
+     * @brief Start measuring a command.
+     * Closes the previous measurement if it is still held.
+     * @param command the command received by the menu
+     * @param item the item under the cursor, can be `NULL`
+     */
+    void begin(const unsigned char command, MenuItem* item);
+    /**
+     * @brief Stop measuring.
+     */
+    void end();
+    /**
+     * @brief Statistics of one command type.
+     */
+    const Stats& get(Command command) const { return stats[command]; }
+    /**
+     * @brief Forget all measurements.
+     */
+    void clear();
+    /**
+     * @brief Print one line per command type that was received.
+     */
+    void printTo(Print& out) const;
+};
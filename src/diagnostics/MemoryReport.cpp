@@ -0,0 +1,97 @@
+#include "MemoryReport.h"
+#include "MenuItem.h"
+
+// The heap symbols only exist in the AVR toolchain. The unit tests define
+// `__AVR__` on a host compiler, `__AVR_ARCH__` is only set by avr-gcc itself.
+#if defined(__AVR__) && defined(__AVR_ARCH__) && !defined(ARDUINO_CI)
+#define MEMORY_REPORT_AVR_HEAP 1
+extern char __heap_start;
+extern char* __brkval;
+
+struct __freelist {
+    size_t sz;
+    struct __freelist* nx;
+};
+extern struct __freelist* __flp;
+#endif
+
+static const __FlashStringHelper* typeName(MemoryReport::Type type) {
+    switch (type) {
+        case MemoryReport::MENU:
+            return F("menu");
+        case MemoryReport::SCREEN:
+            return F("screen");
+        case MemoryReport::ITEM:
+            return F("item");
+        case MemoryReport::WIDGET:
+            return F("widget");
+        case MemoryReport::TEXT:
+            return F("text");
+        default:
+            return F("renderer");
+    }
+}
+
+size_t MemoryReport::total() const {
+    size_t sum = 0;
+    for (uint8_t i = 0; i < TYPE_COUNT; i++) {
+        sum += entries[i].bytes;
+    }
+    return sum;
+}
+
+bool MemoryReport::sampleHeap() {
+#if defined(MEMORY_REPORT_AVR_HEAP)
+    char top;
+    char* heapEnd = __brkval != NULL ? __brkval : &__heap_start;
+    // Blocks returned to the free list, plus the gap between heap and stack
+    heapFree = &top - heapEnd;
+    largestFreeBlock = heapFree;
+    for (struct __freelist* block = __flp; block != NULL; block = block->nx) {
+        size_t size = block->sz + sizeof(size_t);
+        heapFree += size;
+        if (size > largestFreeBlock) largestFreeBlock = size;
+    }
+    heapSampled = true;
+#elif defined(ESP8266)
+    heapFree = ESP.getFreeHeap();
+    largestFreeBlock = ESP.getMaxFreeBlockSize();
+    heapSampled = true;
+#elif defined(ESP32)
+    heapFree = ESP.getFreeHeap();
+    largestFreeBlock = ESP.getMaxAllocHeap();
+    heapSampled = true;
+#endif
+    return heapSampled;
+}
+
+uint8_t MemoryReport::getFragmentation() const {
+    if (heapFree == 0) return 0;
+    return 100 - (uint8_t)((unsigned long)largestFreeBlock * 100 / heapFree);
+}
+
+void MemoryReport::printTo(Print& out) const {
+    for (uint8_t i = 0; i < TYPE_COUNT; i++) {
+        out.print(typeName((Type)i));
+        out.print(F(": "));
+        out.print((unsigned long)entries[i].bytes);
+        out.print(F(" B in "));
+        out.println((unsigned long)entries[i].count);
+    }
+    out.print(F("total: "));
+    out.print((unsigned long)total());
+    out.println(F(" B"));
+    out.print(F("longest value: "));
+    out.print((unsigned long)longestValue);
+    out.print(F(" of "));
+    out.println((unsigned long)(ITEM_DRAW_BUFFER_SIZE - 1));
+    if (heapSampled) {
+        out.print(F("heap free: "));
+        out.print((unsigned long)heapFree);
+        out.print(F(" B, largest block: "));
+        out.print((unsigned long)largestFreeBlock);
+        out.print(F(" B, fragmentation: "));
+        out.print((unsigned long)getFragmentation());
+        out.println(F("%"));
+    }
+}
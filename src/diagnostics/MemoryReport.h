@@ -0,0 +1,106 @@
+#pragma once
+
+#include <Arduino.h>
+#include <utils/lcd_menu_text.h>
+
+/**
+ * @class MemoryReport
+ * @brief RAM taken by a menu, summed per object type.
+ *
+ * Filled by `LcdMenu::memoryReport` for the menu, its renderer and the current
+ * screen, or by `MenuScreen::report` for any other screen. Reports accumulate,
+ * so several screens can be added to the same report.
+ *
+ * Strings referenced by items are counted as `TEXT` because string literals
+ * live in SRAM on AVR. Strings shared between items are counted once per item,
+ * so this type is an upper bound. Strings in flash (`F("...")`) are not counted.
+ *
+ * @example
+ *   MemoryReport report;
+ *   menu.memoryReport(report);
+ *   settingsScreen->report(report);
+ *   report.printTo(Serial);
+ */
+class MemoryReport {
+  public:
+    enum Type : uint8_t {
+        MENU,
+        SCREEN,
+        ITEM,
+        WIDGET,
+        TEXT,
+        RENDERER,
+        TYPE_COUNT
+    };
+
+    struct Entry {
+        size_t bytes;
+        uint16_t count;
+    };
+
+  private:
+    Entry entries[TYPE_COUNT] = {};
+    uint8_t longestValue = 0;
+    bool heapSampled = false;
+    size_t heapFree = 0;
+    size_t largestFreeBlock = 0;
+
+  public:
+    /**
+     * @brief Account for one object.
+     * @param type the type of the object
+     * @param bytes the bytes it takes, including memory it owns
+     * @param count the number of objects to count, 0 when adding owned memory only
+     */
+    void add(Type type, size_t bytes, uint16_t count = 1) {
+        entries[type].bytes += bytes;
+        entries[type].count += count;
+    }
+    /**
+     * @brief Account for a string referenced by an object, unless it is in flash.
+     */
+    void addText(const MenuText& text) {
+        if (!text.isNull() && !text.inFlash) add(TEXT, text.length() + 1, 0);
+    }
+    /**
+     * @brief Record the length of a drawn value.
+     * Used to check that `ITEM_DRAW_BUFFER_SIZE` fits the longest value.
+     */
+    void fitValue(size_t length) {
+        if (length > longestValue) longestValue = length > 0xFF ? 0xFF : length;
+    }
+    const Entry& get(Type type) const { return entries[type]; }
+    /**
+     * @brief Sum of all types.
+     */
+    size_t total() const;
+    /**
+     * @brief Length of the longest value drawn by the reported items.
+     * Values that reached `ITEM_DRAW_BUFFER_SIZE` were truncated.
+     */
+    uint8_t getLongestValue() const { return longestValue; }
+    /**
+     * @brief Read the state of the heap.
+     * Supported on AVR, ESP8266 and ESP32, does nothing elsewhere.
+     * @return `true` if the heap figures are available
+     */
+    bool sampleHeap();
+    bool isHeapSampled() const { return heapSampled; }
+    /**
+     * @brief Free heap, including the gap between heap and stack on AVR.
+     */
+    size_t getHeapFree() const { return heapFree; }
+    /**
+     * @brief Largest block that can still be allocated.
+     */
+    size_t getLargestFreeBlock() const { return largestFreeBlock; }
+    /**
+     * @brief Fragmentation estimate in percent.
+     * 0 when all free memory is one block, close to 100 when it is scattered.
+     */
+    uint8_t getFragmentation() const;
+    /**
+     * @brief Print the report as one line per type.
+     */
+    void printTo(Print& out) const;
+};
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "RenderProfiler.h"
+#include "display/CharacterDisplayInterface.h"
+
+/**
+ * @class ProfilingDisplay
+ * @brief Passes everything through to another display and credits the bytes
+ *        it sends to the item `RenderProfiler` has in scope.
+ *
+ * Characters count one byte each, commands such as `setCursor` or `clear`
+ * count one byte and `createChar` counts the command plus its 8 rows.
+ *
+ * @param display the display to pass through to
+ * @param profiler the profiler to credit bytes to
+ */
+class ProfilingDisplay : public CharacterDisplayInterface {
+  private:
+    CharacterDisplayInterface* display;
+    RenderProfiler* profiler;
+
+  public:
+    ProfilingDisplay(CharacterDisplayInterface* display, RenderProfiler* profiler)
+        : CharacterDisplayInterface(), display(display), profiler(profiler) {}
+
+    void begin() override { display->begin(); }
+
+    void clear() override {
+        profiler->addBytes(1);
+        display->clear();
+    }
+
+    void show() override {
+        profiler->addBytes(1);
+        display->show();
+    }
+
+    void hide() override {
+        profiler->addBytes(1);
+        display->hide();
+    }
+
+    void draw(uint8_t byte) override {
+        profiler->addBytes(1);
+        display->draw(byte);
+    }
+
+    void draw(const char* text) override {
+        profiler->addBytes(strlen(text));
+        display->draw(text);
+    }
+
+    void setCursor(uint8_t col, uint8_t row) override {
+        profiler->addBytes(1);
+        display->setCursor(col, row);
+    }
+
+    void setBacklight(bool enabled) override {
+        profiler->addBytes(1);
+        display->setBacklight(enabled);
+    }
+
+    void createChar(uint8_t id, uint8_t* c) override {
+        profiler->addBytes(9);
+        display->createChar(id, c);
+    }
+
+    void drawBlinker() override {
+        profiler->addBytes(1);
+        display->drawBlinker();
+    }
+
+    void clearBlinker() override {
+        profiler->addBytes(1);
+        display->clearBlinker();
+    }
+
+    uint8_t getBusStatus() override {
+        profiler->addBytes(1);
+        return display->getBusStatus();
+    }
+
+    bool skipsUnchanged() override { return display->skipsUnchanged(); }
+};
@@ -0,0 +1,72 @@
+#include "RenderProfiler.h"
+#include "MenuItem.h"
+
+RenderProfiler::Scope::Scope(RenderProfiler* profiler, MenuItem* item, Kind kind) : profiler(profiler) {
+    if (profiler == NULL) return;
+    entry = profiler->entryOf(item);
+    Entry& e = profiler->entries[entry];
+    if (kind == DRAW) {
+        if (e.draws < 0xFFFF) e.draws++;
+    } else if (e.processes < 0xFFFF) {
+        e.processes++;
+    }
+    // Bytes go to the innermost scope
+    previous = profiler->current;
+    profiler->current = entry;
+    start = micros();
+}
+
+RenderProfiler::Scope::~Scope() {
+    if (profiler == NULL) return;
+    unsigned long elapsed = micros() - start;
+    Entry& e = profiler->entries[entry];
+    e.totalMicros += elapsed;
+    if (elapsed > e.maxMicros) e.maxMicros = elapsed;
+    profiler->current = previous;
+}
+
+uint8_t RenderProfiler::entryOf(MenuItem* item) {
+    for (uint8_t i = 0; i < size; i++) {
+        if (entries[i].item == item) return i;
+    }
+    if (size == RENDER_PROFILER_ITEMS + 1) {
+        // Table is full, use the shared entry
+        return RENDER_PROFILER_ITEMS;
+    }
+    entries[size].item = size < RENDER_PROFILER_ITEMS ? item : NULL;
+    return size++;
+}
+
+const RenderProfiler::Entry* RenderProfiler::find(const MenuItem* item) const {
+    for (uint8_t i = 0; i < size && i < RENDER_PROFILER_ITEMS; i++) {
+        if (entries[i].item == item) return &entries[i];
+    }
+    return NULL;
+}
+
+void RenderProfiler::clear() {
+    memset(entries, 0, sizeof(entries));
+    size = 0;
+    current = NONE;
+}
+
+void RenderProfiler::printTo(Print& out) const {
+    for (uint8_t i = 0; i < size; i++) {
+        const Entry& e = entries[i];
+        if (e.item == NULL) {
+            out.print(F("(others)"));
+        } else {
+            e.item->printText(out);
+        }
+        out.print(F(": draws="));
+        out.print((unsigned long)e.draws);
+        out.print(F(" processes="));
+        out.print((unsigned long)e.processes);
+        out.print(F(" total="));
+        out.print(e.totalMicros);
+        out.print(F("us max="));
+        out.print(e.maxMicros);
+        out.print(F("us bytes="));
+        out.println(e.bytes);
+    }
+}
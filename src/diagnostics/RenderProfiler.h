@@ -0,0 +1,104 @@
+#pragma once
+
+#include <Arduino.h>
+
+class MenuItem;
+
+/**
+ * Number of items the profiler keeps apart, the others are added up together.
+ */
+#ifndef RENDER_PROFILER_ITEMS
+#ifdef __AVR__
+#define RENDER_PROFILER_ITEMS 8
+#else
+#define RENDER_PROFILER_ITEMS 32
+#endif
+#endif
+
+/**
+ * @class RenderProfiler
+ * @brief Attributes the cost of drawing and processing to menu items.
+ *
+ * `MenuScreen` opens a scope around every `MenuItem::draw` and
+ * `MenuItem::process` call when the renderer has a profiler, see
+ * `MenuRenderer::setProfiler`. Each item gets call counts, total and maximum
+ * time and the display bytes sent while it was in scope. Bytes are counted by
+ * `ProfilingDisplay`, place it between the renderer and the display.
+ *
+ * @example
+ *   RenderProfiler profiler;
+ *   ProfilingDisplay profiled(&lcdAdapter, &profiler);
+ *   CharacterDisplayRenderer renderer(&profiled, LCD_COLS, LCD_ROWS);
+ *   ...
+ *   renderer.setProfiler(&profiler);
+ *   ...
+ *   profiler.printTo(Serial);
+ */
+class RenderProfiler {
+  public:
+    enum Kind : uint8_t {
+        DRAW,
+        PROCESS
+    };
+
+    struct Entry {
+        /**
+         * @brief The profiled item, `NULL` for the items that did not fit in the table.
+         */
+        MenuItem* item;
+        uint16_t draws;
+        uint16_t processes;
+        unsigned long totalMicros;
+        unsigned long maxMicros;
+        unsigned long bytes;
+    };
+
+    /**
+     * @brief Profiles one call for as long as it lives.
+     * Does nothing when `profiler` is `NULL`.
+     */
+    class Scope {
+        RenderProfiler* profiler;
+        uint8_t previous;
+        uint8_t entry;
+        unsigned long start;
+
+      public:
+        Scope(RenderProfiler* profiler, MenuItem* item, Kind kind);
+        ~Scope();
+    };
+
+  private:
+    static const uint8_t NONE = 0xFF;
+
+    Entry entries[RENDER_PROFILER_ITEMS + 1] = {};
+    uint8_t size = 0;
+    uint8_t current = NONE;
+
+    uint8_t entryOf(MenuItem* item);
+
+  public:
+    /**
+     * @brief Credit display bytes to the item in scope.
+     */
+    void addBytes(uint16_t bytes) {
+        if (current != NONE) entries[current].bytes += bytes;
+    }
+    /**
+     * @brief Number of entries, including the entry for items that did not fit.
+     */
+    uint8_t getEntryCount() const { return size; }
+    const Entry& getEntry(uint8_t index) const { return entries[index]; }
+    /**
+     * @brief Entry of `item`, `NULL` if it was never profiled.
+     */
+    const Entry* find(const MenuItem* item) const;
+    /**
+     * @brief Forget all measurements.
+     */
+    void clear();
+    /**
+     * @brief Print one line per item.
+     */
+    void printTo(Print& out) const;
+};
@@ -36,4 +36,11 @@ class CharacterDisplayInterface : public DisplayInterface {
      * @brief Clears the blinker from the display.
      */
     virtual void clearBlinker() = 0;
+
+    /**
+     * @brief Check the connection to the display.
+     * @return the status of `Wire.endTransmission`, `0` if the display answers
+     *         or the adapter cannot detect errors
+     */
+    virtual uint8_t getBusStatus() { return 0; }
 };
@@ -22,6 +22,11 @@ class DisplayInterface {
     virtual void draw(const char* text) = 0;
     virtual void setCursor(uint8_t col, uint8_t row) = 0;
     virtual void setBacklight(bool enabled) = 0;
+    /**
+     * @brief Check if the characters already on the display are not sent again.
+     * Such a display is cleared before the menu is shown again, see `LcdMenu::show`.
+     */
+    virtual bool skipsUnchanged() { return false; }
     virtual ~DisplayInterface() {}
 };
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Arduino.h>
+#include <Wire.h>
 #include <LCD_I2C.h>
 #include <utils/lcd_menu_constants.h>
 #include <utils/lcd_menu_utils.h>
@@ -22,13 +23,15 @@
  * @note This class requires the LCD_I2C library.
  *
  * @param lcd Pointer to a LCD_I2C object that this adapter will interact with.
+ * @param address I2C address of the display, enables `getBusStatus` when not `0`.
  */
 class LCD_I2CAdapter : public CharacterDisplayInterface {
   private:
     LCD_I2C* lcd;
+    uint8_t address;
 
   public:
-    LCD_I2CAdapter(LCD_I2C* lcd) : CharacterDisplayInterface(), lcd(lcd) {}
+    LCD_I2CAdapter(LCD_I2C* lcd, uint8_t address = 0) : CharacterDisplayInterface(), lcd(lcd), address(address) {}
 
     void begin() override {
         lcd->begin();
@@ -79,4 +82,10 @@ class LCD_I2CAdapter : public CharacterDisplayInterface {
     }
 
     void clear() override { lcd->clear(); }
+
+    uint8_t getBusStatus() override {
+        if (address == 0) return 0;
+        Wire.beginTransmission(address);
+        return Wire.endTransmission();
+    }
 };
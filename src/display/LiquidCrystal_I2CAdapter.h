@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Arduino.h>
+#include <Wire.h>
 #include <LiquidCrystal_I2C.h>
 #include <utils/lcd_menu_constants.h>
 #include <utils/lcd_menu_utils.h>
@@ -19,13 +20,15 @@
  * @note This class requires the LiquidCrystal_I2C library.
  *
  * @param lcd Pointer to a LiquidCrystal_I2C object that this adapter will interact with.
+ * @param address I2C address of the display, enables `getBusStatus` when not `0`.
  */
 class LiquidCrystal_I2CAdapter : public CharacterDisplayInterface {
   private:
     LiquidCrystal_I2C* lcd;
+    uint8_t address;
 
   public:
-    LiquidCrystal_I2CAdapter(LiquidCrystal_I2C* lcd) : CharacterDisplayInterface(), lcd(lcd) {}
+    LiquidCrystal_I2CAdapter(LiquidCrystal_I2C* lcd, uint8_t address = 0) : CharacterDisplayInterface(), lcd(lcd), address(address) {}
 
     void begin() override {
         lcd->init();
@@ -72,4 +75,10 @@ class LiquidCrystal_I2CAdapter : public CharacterDisplayInterface {
     }
 
     void clear() override { lcd->clear(); }
+
+    uint8_t getBusStatus() override {
+        if (address == 0) return 0;
+        Wire.beginTransmission(address);
+        return Wire.endTransmission();
+    }
 };
@@ -0,0 +1,308 @@
+#pragma once
+
+#include "CharacterDisplayInterface.h"
+#include <string.h>
+#include <utils/lcd_menu_clock.h>
+#include <utils/lcd_menu_utils.h>
+
+/**
+ * Largest display `ShadowDisplay` can keep a copy of.
+ */
+#ifndef SHADOW_DISPLAY_COLS
+#define SHADOW_DISPLAY_COLS 20
+#endif
+#ifndef SHADOW_DISPLAY_ROWS
+#define SHADOW_DISPLAY_ROWS 4
+#endif
+
+/**
+ * Milliseconds before the first attempt to bring a faulty display back,
+ * doubled after every failed attempt up to `SHADOW_DISPLAY_MAX_RETRY`.
+ */
+#ifndef SHADOW_DISPLAY_MIN_RETRY
+#define SHADOW_DISPLAY_MIN_RETRY 50
+#endif
+#ifndef SHADOW_DISPLAY_MAX_RETRY
+#define SHADOW_DISPLAY_MAX_RETRY 5000
+#endif
+
+/**
+ * Milliseconds between two checks of the bus of a healthy display, the bus
+ * is also checked before every scrubbed row.
+ */
+#ifndef SHADOW_DISPLAY_BUS_CHECK
+#define SHADOW_DISPLAY_BUS_CHECK 250
+#endif
+
+/**
+ * @class ShadowDisplay
+ * @brief Keeps a copy of what is on another display and repairs the display from it.
+ *
+ * Everything is passed through to the display and recorded: the characters
+ * of every cell, the custom characters, the cursor, the blinker, the
+ * backlight and whether the display is shown.
+ *
+ * Characters that are already on the display are not sent again, and the
+ * cursor is only moved before a character that changed, so redrawing a
+ * whole screen costs only the cells that differ, see `setSkipUnchanged`.
+ *
+ * `update` rewrites one row per `scrubInterval`, so a panel showing garbage
+ * is repaired row by row without clearing it. It also checks the bus with
+ * `getBusStatus` every `SHADOW_DISPLAY_BUS_CHECK` milliseconds and before
+ * every scrubbed row. After an error the display is initialized again and
+ * restored from the copy as soon as the bus answers. While the bus does not
+ * answer, the time between attempts doubles from `SHADOW_DISPLAY_MIN_RETRY`
+ * up to `SHADOW_DISPLAY_MAX_RETRY`.
+ *
+ * @example
+ *   LiquidCrystal_I2CAdapter lcdAdapter(&lcd, 0x27);
+ *   ShadowDisplay shadow(&lcdAdapter, LCD_COLS, LCD_ROWS);
+ *   CharacterDisplayRenderer renderer(&shadow, LCD_COLS, LCD_ROWS);
+ *   ...
+ *   void loop() {
+ *       shadow.update();
+ *   }
+ *
+ * @param display the display to pass through to
+ * @param cols number of columns, at most `SHADOW_DISPLAY_COLS`
+ * @param rows number of rows, at most `SHADOW_DISPLAY_ROWS`
+ * @param scrubInterval milliseconds between two rewritten rows, `0` to only watch the bus
+ */
+class ShadowDisplay : public CharacterDisplayInterface {
+  private:
+    CharacterDisplayInterface* display;
+    const uint8_t cols;
+    const uint8_t rows;
+    char cells[SHADOW_DISPLAY_ROWS][SHADOW_DISPLAY_COLS];
+    uint8_t glyphs[8][8];
+    uint8_t glyphMask = 0;
+    uint8_t col = 0;
+    uint8_t row = 0;
+    bool visible = true;
+    bool backlight = true;
+    bool blinking = false;
+    bool skipUnchanged = true;
+    /**
+     * @brief The cursor of the display is not at `col`, `row`.
+     */
+    bool seeking = false;
+
+    Clock* clock = &systemClock();
+    uint16_t scrubInterval;
+    unsigned long lastScrub = 0;
+    unsigned long lastBusCheck = 0;
+    uint8_t scrubRow = 0;
+    /**
+     * @brief Time until the next attempt to bring the display back, `0` while it is healthy.
+     */
+    uint16_t retryDelay = 0;
+    unsigned long lastRetry = 0;
+    uint16_t faults = 0;
+    uint16_t resyncs = 0;
+
+    void record(uint8_t byte) {
+        if (col < cols && row < rows) cells[row][col] = byte;
+        col++;
+    }
+
+    void seek() {
+        if (!seeking) return;
+        display->setCursor(col, row);
+        seeking = false;
+    }
+
+    void clearCells() {
+        memset(cells, ' ', sizeof(cells));
+        col = 0;
+        row = 0;
+    }
+
+    void drawRow(uint8_t r) {
+        display->setCursor(0, r);
+        for (uint8_t c = 0; c < cols; c++) {
+            display->draw(static_cast<uint8_t>(cells[r][c]));
+        }
+    }
+
+  public:
+    ShadowDisplay(CharacterDisplayInterface* display, uint8_t cols, uint8_t rows, uint16_t scrubInterval = 250)
+        : CharacterDisplayInterface(),
+          display(display),
+          cols(cols < SHADOW_DISPLAY_COLS ? cols : SHADOW_DISPLAY_COLS),
+          rows(rows < SHADOW_DISPLAY_ROWS ? rows : SHADOW_DISPLAY_ROWS),
+          scrubInterval(scrubInterval) {
+        clearCells();
+    }
+
+    void begin() override {
+        display->begin();
+        clearCells();
+        seeking = false;
+        visible = true;
+        backlight = true;
+        blinking = false;
+        lastScrub = clock->now();
+        lastBusCheck = lastScrub;
+    }
+
+    void clear() override {
+        display->clear();
+        clearCells();
+        seeking = false;
+    }
+
+    void show() override {
+        display->show();
+        visible = true;
+        backlight = true;
+    }
+
+    void hide() override {
+        display->hide();
+        visible = false;
+    }
+
+    void draw(uint8_t byte) override {
+        if (skipUnchanged && col < cols && row < rows && cells[row][col] == static_cast<char>(byte)) {
+            col++;
+            seeking = true;
+            return;
+        }
+        seek();
+        display->draw(byte);
+        record(byte);
+    }
+
+    void draw(const char* text) override {
+        if (skipUnchanged) {
+            while (*text) draw(static_cast<uint8_t>(*text++));
+            return;
+        }
+        display->draw(text);
+        while (*text) record(*text++);
+    }
+
+    void setCursor(uint8_t col, uint8_t row) override {
+        this->col = col;
+        this->row = row;
+        seeking = true;
+        // The blinker shows where the cursor is, it cannot wait for the next change
+        if (!skipUnchanged || blinking) seek();
+    }
+
+    void setBacklight(bool enabled) override {
+        display->setBacklight(enabled);
+        backlight = enabled;
+    }
+
+    void createChar(uint8_t id, uint8_t* c) override {
+        display->createChar(id, c);
+        memcpy(glyphs[id & 7], c, 8);
+        glyphMask |= 1 << (id & 7);
+        // The display now writes to the glyph memory, move back before the next character
+        seeking = true;
+    }
+
+    void drawBlinker() override {
+        seek();
+        display->drawBlinker();
+        blinking = true;
+    }
+
+    void clearBlinker() override {
+        display->clearBlinker();
+        blinking = false;
+    }
+
+    uint8_t getBusStatus() override { return display->getBusStatus(); }
+
+    bool skipsUnchanged() override { return skipUnchanged; }
+
+    /**
+     * @brief Choose whether characters already on the display are sent again, they are not by default.
+     */
+    void setSkipUnchanged(bool skip) {
+        skipUnchanged = skip;
+        seek();
+    }
+
+    /**
+     * @brief Check the bus and rewrite the next row when it is due.
+     * Call it in `loop()`. Does nothing while the display is hidden.
+     */
+    void update() {
+        if (!visible) return;
+        unsigned long now = clock->now();
+        if (retryDelay != 0) {
+            if (now - lastRetry < retryDelay) return;
+            lastRetry = now;
+            if (display->getBusStatus() != 0) {
+                retryDelay = retryDelay < SHADOW_DISPLAY_MAX_RETRY / 2 ? retryDelay * 2 : SHADOW_DISPLAY_MAX_RETRY;
+                return;
+            }
+            retryDelay = 0;
+            resync();
+            return;
+        }
+        bool scrubDue = scrubInterval != 0 && now - lastScrub >= scrubInterval;
+        if (!scrubDue && now - lastBusCheck < SHADOW_DISPLAY_BUS_CHECK) return;
+        lastBusCheck = now;
+        if (display->getBusStatus() != 0) {
+            faults++;
+            retryDelay = SHADOW_DISPLAY_MIN_RETRY;
+            lastRetry = now;
+            LOG(F("ShadowDisplay::fault"), faults);
+            return;
+        }
+        if (!scrubDue) return;
+        lastScrub = now;
+        drawRow(scrubRow);
+        display->setCursor(col, row);
+        seeking = false;
+        scrubRow = (scrubRow + 1) % rows;
+    }
+
+    /**
+     * @brief Initialize the display again and restore everything from the copy.
+     */
+    void resync() {
+        display->begin();
+        for (uint8_t id = 0; id < 8; id++) {
+            if (glyphMask & (1 << id)) display->createChar(id, glyphs[id]);
+        }
+        for (uint8_t r = 0; r < rows; r++) {
+            drawRow(r);
+        }
+        if (!backlight) display->setBacklight(false);
+        if (!visible) display->hide();
+        if (blinking) display->drawBlinker();
+        display->setCursor(col, row);
+        seeking = false;
+        resyncs++;
+        lastScrub = clock->now();
+        lastBusCheck = lastScrub;
+        LOG(F("ShadowDisplay::resync"), resyncs);
+    }
+
+    /**
+     * @brief Use `clock` instead of `millis()`, see `MenuRenderer::setClock`.
+     */
+    void setClock(Clock* clock) { this->clock = clock != NULL ? clock : &systemClock(); }
+
+    /**
+     * @brief `true` unless the last check of the bus failed.
+     */
+    bool isHealthy() const { return retryDelay == 0; }
+    /**
+     * @brief Number of bus errors detected.
+     */
+    uint16_t getFaultCount() const { return faults; }
+    /**
+     * @brief Number of times the display was initialized again.
+     */
+    uint16_t getResyncCount() const { return resyncs; }
+    /**
+     * @brief Character at `col`, `row` of the copy.
+     */
+    char getCell(uint8_t col, uint8_t row) const { return col < cols && row < rows ? cells[row][col] : ' '; }
+};
@@ -67,6 +67,7 @@ class AnalogButtonAdapter : public InputInterface {
         : AnalogButtonAdapter(menu, pinNumber, triggerValue, ButtonConfig::DEFAULT_MARGIN, command, repeatDelay, repeatInterval, debounceTime) {}
 
     void observe() override {
+        TRACE_DRAIN();
         int16_t analogValue = analogRead(pinNumber);
         if (analogValue >= ButtonConfig::MAX_VALUE) {
             wasPressed = false;
@@ -78,7 +79,7 @@ class AnalogButtonAdapter : public InputInterface {
         int16_t lower = center - static_cast<int16_t>(margin);
         int16_t upper = center + static_cast<int16_t>(margin);
         bool pressed = analogValue <= upper && analogValue >= lower;
-        unsigned long currentTime = millis();
+        unsigned long currentTime = now();
 
         if (!pressed) {
             wasPressed = false;
@@ -91,9 +92,9 @@ class AnalogButtonAdapter : public InputInterface {
                 return;
             }
             wasPressed = true;
-            menu->process(command);
+            dispatch(command);
         } else if (repeat.shouldRepeat(currentTime)) {
-            menu->process(command);
+            dispatch(command);
         }
     }
 };
\ No newline at end of file
@@ -42,17 +42,18 @@ class ButtonAdapter : public InputInterface {
           repeat(repeatDelay, repeatInterval) {}
 
     void observe() override {
+        TRACE_DRAIN();
         if (button->pressed()) {
-            menu->process(command);
+            dispatch(command);
             holding = true;
             if (repeat.enabled()) {
-                repeat.start(millis());
+                repeat.start(now());
             }
         } else if (button->released()) {
             holding = false;
             repeat.reset();
-        } else if (repeat.enabled() && holding && repeat.shouldRepeat(millis())) {
-            menu->process(command);
+        } else if (repeat.enabled() && holding && repeat.shouldRepeat(now())) {
+            dispatch(command);
         }
     }
 };
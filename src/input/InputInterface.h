@@ -18,6 +18,37 @@ class InputInterface {
   protected:
     LcdMenu* menu = NULL;
 
+    /**
+     * @brief Adapter wrapping this one that receives its commands, see `InputRecorder`.
+     */
+    InputInterface* wrapper = NULL;
+
+    /**
+     * @brief Send a command to the menu, or to the wrapper if there is one.
+     * Adapters call this instead of `LcdMenu::process`.
+     * @return `true` if the command was processed
+     */
+    bool dispatch(const unsigned char command) {
+        return wrapper != NULL ? wrapper->handle(command) : menu->process(command);
+    }
+
+    /**
+     * @brief Receive a command from the wrapped adapter.
+     * Wrappers override this and call `dispatch` to pass the command on.
+     */
+    virtual bool handle(const unsigned char command) { return dispatch(command); }
+
+    /**
+     * @brief Route the commands of `adapter` through `wrapper`.
+     */
+    static void wrap(InputInterface* adapter, InputInterface* wrapper) { adapter->wrapper = wrapper; }
+
+    /**
+     * @brief Current time of the menu's clock in milliseconds.
+     * Adapters use it instead of `millis()`, see `MenuRenderer::setClock`.
+     */
+    unsigned long now() { return menu->getClock()->now(); }
+
   public:
     InputInterface(LcdMenu* menu) : menu(menu) {}
 
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "InputInterface.h"
+#include "InputRecording.h"
+
+/**
+ * @class InputRecorder
+ * @brief Records the commands another adapter sends to the menu.
+ *
+ * Wraps any adapter: call `observe` of the recorder instead of the adapter's.
+ * Commands still reach the menu, and are appended to the recording while
+ * recording is on. Play them back with `ReplayAdapter`.
+ *
+ * @example
+ *   uint8_t storage[3 * 100];
+ *   InputRecording recording(storage, sizeof(storage));
+ *   KeyboardAdapter keyboard(&menu, &Serial);
+ *   InputRecorder recorder(&menu, &keyboard, &recording);
+ *   ...
+ *   void loop() {
+ *       recorder.observe();
+ *   }
+ *
+ * @param menu the menu the adapter controls
+ * @param adapter the adapter to record
+ * @param recording the buffer to record to
+ */
+class InputRecorder : public InputInterface {
+  private:
+    InputInterface* adapter;
+    InputRecording* recording;
+    bool enabled = true;
+
+  public:
+    InputRecorder(LcdMenu* menu, InputInterface* adapter, InputRecording* recording)
+        : InputInterface(menu), adapter(adapter), recording(recording) {
+        wrap(adapter, this);
+    }
+
+    ~InputRecorder() override { wrap(adapter, NULL); }
+
+    void observe() override { adapter->observe(); }
+
+    /**
+     * @brief Start recording, the delay of the first command is measured from now.
+     */
+    void start() {
+        enabled = true;
+        recording->start(now());
+    }
+    /**
+     * @brief Stop recording, commands still reach the menu.
+     */
+    void stop() { enabled = false; }
+    bool isRecording() const { return enabled; }
+
+  protected:
+    bool handle(const unsigned char command) override {
+        if (enabled) {
+            recording->record(command, now());
+        }
+        return dispatch(command);
+    }
+};
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <Arduino.h>
+#include <utils/lcd_menu_constants.h>
+
+/**
+ * @class InputRecording
+ * @brief Compact buffer of commands and the time between them.
+ *
+ * Each command takes 3 bytes: the command and the milliseconds since the
+ * previous command, capped at 65535. The buffer is provided by the caller so
+ * its size and placement can be chosen per board.
+ *
+ * Filled by `InputRecorder`, played back by `ReplayAdapter`.
+ *
+ * @example
+ *   uint8_t storage[3 * 100];
+ *   InputRecording recording(storage, sizeof(storage));
+ */
+class InputRecording {
+  public:
+    /**
+     * Bytes taken by each recorded command.
+     */
+    static const uint8_t EVENT_SIZE = 3;
+
+  private:
+    uint8_t* buffer;
+    uint16_t capacity;
+    uint16_t length = 0;
+    unsigned long lastTime = 0;
+    bool started = false;
+    bool overflow = false;
+
+  public:
+    /**
+     * @param buffer storage for the commands
+     * @param size size of `buffer` in bytes
+     */
+    InputRecording(uint8_t* buffer, size_t size)
+        : buffer(buffer), capacity(size / EVENT_SIZE > 0xFFFF ? 0xFFFF : size / EVENT_SIZE) {}
+
+    /**
+     * @brief Start measuring the delay of the first command from `now`.
+     * Without it the first command is recorded without delay.
+     */
+    void start(unsigned long now) {
+        lastTime = now;
+        started = true;
+    }
+    /**
+     * @brief Append a command received at `now` milliseconds.
+     * @return `false` if the buffer is full, the command is dropped
+     */
+    bool record(const unsigned char command, unsigned long now) {
+        if (length == capacity) {
+            overflow = true;
+            return false;
+        }
+        unsigned long delay = started ? now - lastTime : 0;
+        if (delay > 0xFFFF) delay = 0xFFFF;
+        uint8_t* event = buffer + length * EVENT_SIZE;
+        event[0] = command;
+        event[1] = delay & 0xFF;
+        event[2] = delay >> 8;
+        length++;
+        lastTime = now;
+        started = true;
+        return true;
+    }
+    /**
+     * @brief Forget all commands.
+     */
+    void clear() {
+        length = 0;
+        started = false;
+        overflow = false;
+    }
+    /**
+     * @brief Number of recorded commands.
+     */
+    uint16_t size() const { return length; }
+    /**
+     * @brief Maximum number of commands.
+     */
+    uint16_t getCapacity() const { return capacity; }
+    /**
+     * @brief Check if commands were dropped because the buffer was full.
+     */
+    bool hasOverflowed() const { return overflow; }
+    unsigned char getCommand(uint16_t index) const { return buffer[index * EVENT_SIZE]; }
+    /**
+     * @brief Milliseconds between the command at `index` and the one before it.
+     */
+    uint16_t getDelay(uint16_t index) const {
+        const uint8_t* event = buffer + index * EVENT_SIZE;
+        return event[1] | (event[2] << 8);
+    }
+    /**
+     * @brief Total milliseconds covered by the recording.
+     */
+    unsigned long getDuration() const {
+        unsigned long duration = 0;
+        for (uint16_t i = 0; i < length; i++) duration += getDelay(i);
+        return duration;
+    }
+    /**
+     * @brief Print the commands as whitespace separated tokens, one command per
+     * line preceded by its delay in milliseconds.
+     *
+     * The output can be replayed by the native fuzzer, see `bench/README.md`.
+     */
+    void printTo(Print& out) const {
+        for (uint16_t i = 0; i < length; i++) {
+            out.print('+');
+            out.print((unsigned long)getDelay(i));
+            out.print(F("ms "));
+            printCommand(out, getCommand(i));
+            out.println();
+        }
+    }
+
+  private:
+    static void printCommand(Print& out, const unsigned char command) {
+        switch (command) {
+            case UP:
+                out.print(F("UP"));
+                return;
+            case DOWN:
+                out.print(F("DOWN"));
+                return;
+            case LEFT:
+                out.print(F("LEFT"));
+                return;
+            case RIGHT:
+                out.print(F("RIGHT"));
+                return;
+            case ENTER:
+                out.print(F("ENTER"));
+                return;
+            case BACK:
+                out.print(F("BACK"));
+                return;
+            case BACKSPACE:
+                out.print(F("BACKSPACE"));
+                return;
+            case CLEAR:
+                out.print(F("CLEAR"));
+                return;
+        }
+        if (command > ' ' && command < 0x7F && command != '#') {
+            out.print((char)command);
+            return;
+        }
+        const char* hex = "0123456789ABCDEF";
+        out.print(F("0x"));
+        out.print(hex[command >> 4]);
+        out.print(hex[command & 0x0F]);
+    }
+};
@@ -66,6 +66,7 @@ class JoystickAdapter : public InputInterface {
           rightCmd(rightCmd), upCmd(upCmd), downCmd(downCmd) {}
 
     void observe() override {
+        TRACE_DRAIN();
         int h = analogRead(hPin);
         int v = analogRead(vPin);
         int8_t horiz = readAxis(h);
@@ -74,18 +75,18 @@ class JoystickAdapter : public InputInterface {
         if (horiz != lastHoriz) {
             lastHoriz = horiz;
             if (horiz == -1) {
-                menu->process(leftCmd);
+                dispatch(leftCmd);
             } else if (horiz == 1) {
-                menu->process(rightCmd);
+                dispatch(rightCmd);
             }
         }
 
         if (vert != lastVert) {
             lastVert = vert;
             if (vert == -1) {
-                menu->process(upCmd);
+                dispatch(upCmd);
             } else if (vert == 1) {
-                menu->process(downCmd);
+                dispatch(downCmd);
             }
         }
     }
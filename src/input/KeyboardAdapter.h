@@ -122,12 +122,11 @@ class KeyboardAdapter : public InputInterface {
         lastCharTimestamp = 0;
     }
     inline bool hasLastChar() {
-        // TODO: Check millis() overflow situation
-        return lastChar != 0 && millis() > lastCharTimestamp + THRESHOLD;
+        return lastChar != 0 && now() - lastCharTimestamp > THRESHOLD;
     }
     inline void saveLastChar(unsigned char command) {
         lastChar = command;
-        lastCharTimestamp = millis();
+        lastCharTimestamp = now();
     }
     /**
      * @brief Handle idle state when there are no input for some time.
@@ -137,11 +136,11 @@ class KeyboardAdapter : public InputInterface {
         switch (lastChar) {
             case CR:  // Received single `\r`
                 // LOG(F("Call ENTER from idle"));
-                menu->process(ENTER);
+                dispatch(ENTER);
                 break;
             case ESC:  // Received single `ESC`
                 // LOG(F("Call BACK from idle"));
-                menu->process(BACK);
+                dispatch(BACK);
                 break;
         }
     }
@@ -155,10 +154,10 @@ class KeyboardAdapter : public InputInterface {
                 switch (command) {
                     case BS:   // 8. On Win
                     case DEL:  // 127. On Mac
-                        menu->process(BACKSPACE);
+                        dispatch(BACKSPACE);
                         break;
                     case LF:  // 10, \n
-                        menu->process(ENTER);
+                        dispatch(ENTER);
                         break;
                     case CR:  // 13, \r
                         // Can be \r\n sequence, do nothing
@@ -167,7 +166,7 @@ class KeyboardAdapter : public InputInterface {
                         codeSet = CodeSet::C1;
                         break;
                     default:
-                        menu->process(command);
+                        dispatch(command);
                         break;
                 }
                 saveLastChar(command);
@@ -186,16 +185,16 @@ class KeyboardAdapter : public InputInterface {
                 if (command >= C2_CSI_TERMINAL_MIN && command <= C2_CSI_TERMINAL_MAX) {
                     switch (command) {
                         case 'A':
-                            menu->process(UP);
+                            dispatch(UP);
                             break;
                         case 'B':
-                            menu->process(DOWN);
+                            dispatch(DOWN);
                             break;
                         case 'C':
-                            menu->process(RIGHT);
+                            dispatch(RIGHT);
                             break;
                         case 'D':
-                            menu->process(LEFT);
+                            dispatch(LEFT);
                             break;
                         case 'F':
                             LOG(F("End"));
@@ -210,7 +209,7 @@ class KeyboardAdapter : public InputInterface {
                                         LOG(F("Insert"));
                                         break;
                                     case 3:  // Delete
-                                        menu->process(CLEAR);
+                                        dispatch(CLEAR);
                                         break;
                                     case 5:  // PgUp
                                         LOG(F("PgUp"));
@@ -238,6 +237,7 @@ class KeyboardAdapter : public InputInterface {
         : InputInterface(menu), stream(stream) {
     }
     void observe() override {
+        TRACE_DRAIN();
         if (!stream->available()) {
             if (hasLastChar()) {
                 handleIdle();
@@ -0,0 +1,190 @@
+#include "LcdMenuConfig.h"
+
+#if LCDMENU_WIDGETS
+#include "RemoteControl.h"
+#include "MenuItem.h"
+#include "MenuScreen.h"
+#include "widget/BaseWidget.h"
+
+// Bytes of an address after its tag
+#define ADDRESS_SIZE 2
+
+uint8_t RemoteControl::crc8(uint8_t crc, uint8_t byte) {
+    crc ^= byte;
+    for (uint8_t i = 0; i < 8; i++) {
+        crc = crc & 0x80 ? (crc << 1) ^ 0x07 : crc << 1;
+    }
+    return crc;
+}
+
+uint8_t RemoteControl::addScreen(MenuScreen* screen) {
+    if (screenCount == REMOTE_CONTROL_SCREENS) return 0;
+    screens[screenCount++] = screen;
+    return screenCount;
+}
+
+bool RemoteControl::bind(uint16_t id, MenuItem* item) {
+    for (uint8_t i = 0; i < bindingCount; i++) {
+        if (bindings[i].id == id) {
+            bindings[i].item = item;
+            return true;
+        }
+    }
+    if (bindingCount == REMOTE_CONTROL_BINDINGS) return false;
+    bindings[bindingCount].id = id;
+    bindings[bindingCount].item = item;
+    bindingCount++;
+    return true;
+}
+
+void RemoteControl::observe() {
+    if (state != WAIT_SYNC && now() - lastByteTime > REMOTE_CONTROL_TIMEOUT) {
+        // The rest of the request is lost
+        state = WAIT_SYNC;
+    }
+    while (stream->available() > 0) {
+        lastByteTime = now();
+        receive(stream->read());
+    }
+}
+
+void RemoteControl::receive(uint8_t byte) {
+    switch (state) {
+        case WAIT_SYNC:
+            if (byte == REQUEST_SYNC) state = WAIT_LENGTH;
+            break;
+        case WAIT_LENGTH:
+            length = byte;
+            received = 0;
+            crc = 0;
+            state = length == 0 ? WAIT_CHECKSUM : length > REMOTE_CONTROL_FRAME_SIZE ? SKIP_PAYLOAD : WAIT_PAYLOAD;
+            break;
+        case WAIT_PAYLOAD:
+            frame[received++] = byte;
+            crc = crc8(crc, byte);
+            if (received == length) state = WAIT_CHECKSUM;
+            break;
+        case SKIP_PAYLOAD:
+            if (++received == length) {
+                // The checksum byte is left to WAIT_SYNC
+                state = WAIT_SYNC;
+                respond(TOO_LONG);
+            }
+            break;
+        case WAIT_CHECKSUM:
+            state = WAIT_SYNC;
+            if (byte != crc) {
+                respond(BAD_CHECKSUM);
+            } else {
+                execute();
+            }
+            break;
+    }
+}
+
+uint8_t RemoteControl::countOperations() {
+    uint8_t count = 0;
+    uint8_t i = 0;
+    while (i < length) {
+        uint8_t operation = frame[i++];
+        if (operation == KEY) {
+            i += 1;
+        } else if (operation == GET || operation == SET) {
+            if (i >= length || (frame[i] != BY_POSITION && frame[i] != BY_ID)) return 0;
+            // Tag, address and widget index
+            i += 1 + ADDRESS_SIZE + 1;
+            if (operation == SET) {
+                if (i >= length || (frame[i] != WidgetNumber::INTEGER && frame[i] != WidgetNumber::REAL)) return 0;
+                i += 1 + sizeof(int32_t);
+            }
+        } else {
+            return 0;
+        }
+        if (i > length) return 0;
+        count++;
+    }
+    return count;
+}
+
+MenuItem* RemoteControl::findItem(const uint8_t* address) {
+    if (address[0] == BY_ID) {
+        uint16_t id = address[1] | (address[2] << 8);
+        for (uint8_t i = 0; i < bindingCount; i++) {
+            if (bindings[i].id == id) return bindings[i].item;
+        }
+        return NULL;
+    }
+    uint8_t number = address[1];
+    MenuScreen* screen = number == 0 ? menu->getScreen() : number <= screenCount ? screens[number - 1] : NULL;
+    if (screen == NULL || address[2] >= screen->size()) return NULL;
+    return screen->getItemAt(address[2]);
+}
+
+void RemoteControl::execute() {
+    uint8_t count = countOperations();
+    if (count == 0 && length > 0) {
+        respond(MALFORMED);
+        return;
+    }
+    crc = 0;
+    stream->write(RESPONSE_SYNC);
+    send(OK);
+    send(count);
+    bool changed = false;
+    uint8_t i = 0;
+    while (i < length) {
+        uint8_t operation = frame[i++];
+        WidgetNumber number;
+        if (operation == KEY) {
+            number = WidgetNumber::fromInteger(dispatch(frame[i++]) ? 1 : 0);
+            sendRecord(OK, number);
+            continue;
+        }
+        MenuItem* item = findItem(frame + i);
+        i += 1 + ADDRESS_SIZE;
+        BaseWidget* widget = item != NULL ? item->getWidgetAt(frame[i]) : NULL;
+        i++;
+        Status status = item == NULL ? NO_ITEM : widget == NULL ? NO_WIDGET : OK;
+        if (operation == SET) {
+            WidgetNumber value;
+            value.type = static_cast<WidgetNumber::Type>(frame[i++]);
+            memcpy(&value.integer, frame + i, sizeof(int32_t));
+            i += sizeof(int32_t);
+            if (status == OK) {
+                if (widget->writeNumber(value)) {
+                    changed = true;
+                } else {
+                    status = NOT_A_NUMBER;
+                }
+            }
+        }
+        if (status == OK && !widget->readNumber(number)) status = NOT_A_NUMBER;
+        sendRecord(status, status == OK ? number : WidgetNumber());
+    }
+    if (changed) menu->refresh();
+    // Sent last so the display is up to date when the response completes
+    stream->write(crc);
+}
+
+void RemoteControl::respond(Status status) {
+    crc = 0;
+    stream->write(RESPONSE_SYNC);
+    send(status);
+    send(0);
+    stream->write(crc);
+}
+
+void RemoteControl::sendRecord(Status status, const WidgetNumber& number) {
+    send(status);
+    send(number.type);
+    uint8_t bytes[sizeof(int32_t)];
+    memcpy(bytes, &number.integer, sizeof(bytes));
+    for (uint8_t b = 0; b < sizeof(bytes); b++) send(bytes[b]);
+}
+
+void RemoteControl::send(uint8_t byte) {
+    crc = crc8(crc, byte);
+    stream->write(byte);
+}
+
+#endif
@@ -0,0 +1,193 @@
+#pragma once
+
+#include "InputInterface.h"
+#include "LcdMenuConfig.h"
+#include "Stream.h"
+#include "widget/WidgetNumber.h"
+
+#if !LCDMENU_WIDGETS
+#error "RemoteControl needs widgets, see LCDMENU_WIDGETS in LcdMenuConfig.h"
+#endif
+
+class MenuItem;
+class MenuScreen;
+
+/**
+ * Largest request payload in bytes.
+ */
+#ifndef REMOTE_CONTROL_FRAME_SIZE
+#ifdef __AVR__
+#define REMOTE_CONTROL_FRAME_SIZE 48
+#else
+#define REMOTE_CONTROL_FRAME_SIZE 200
+#endif
+#endif
+
+/**
+ * Number of items that can be bound to an ID.
+ */
+#ifndef REMOTE_CONTROL_BINDINGS
+#ifdef __AVR__
+#define REMOTE_CONTROL_BINDINGS 16
+#else
+#define REMOTE_CONTROL_BINDINGS 64
+#endif
+#endif
+
+/**
+ * Number of screens that can be addressed by number, besides the current one.
+ */
+#ifndef REMOTE_CONTROL_SCREENS
+#define REMOTE_CONTROL_SCREENS 8
+#endif
+
+/**
+ * Milliseconds without a byte after which a partial request is dropped.
+ */
+#ifndef REMOTE_CONTROL_TIMEOUT
+#define REMOTE_CONTROL_TIMEOUT 100
+#endif
+
+/**
+ * @class RemoteControl
+ * @brief Binary protocol to read and set widget values in batches over a `Stream`.
+ *
+ * Meant for test jigs and host tools that need to configure a unit quickly
+ * instead of emulating key presses.
+ *
+ * Request: `0xA5`, payload length, payload, CRC-8 of the payload.
+ * The payload is a list of operations, each operation addresses one item:
+ * - `'P' screen index` - item `index` of screen `screen`, screen `0` is the
+ *   current screen, the others are numbered by `addScreen`;
+ * - `'I' idLow idHigh` - item bound to `id` with `bind`.
+ *
+ * Operations:
+ * - `'G' address widget` - read the widget's value;
+ * - `'S' address widget type value` - set the widget's value with
+ *   `BaseWidget::writeNumber`, `type` is `'i'` for `int32` or `'f'` for
+ *   `float`, `value` is 4 bytes little endian;
+ * - `'K' command` - send a command to the menu, as an adapter would.
+ *
+ * Response: `0x5A`, frame status, record count, one record per operation,
+ * CRC-8 of everything after `0x5A`. A record is 6 bytes: status, type and
+ * value. `G` and `S` return the widget's value, `S` after clamping, `K`
+ * returns `1` if the command was processed. When the frame status is not
+ * `OK` nothing was executed and there are no records.
+ *
+ * The menu is refreshed once after the batch if any value was set.
+ *
+ * @example
+ *   RemoteControl remote(&menu, &Serial);
+ *   ...
+ *   remote.addScreen(settingsScreen);  // screen 1
+ *   remote.bind(100, settingsScreen->getItemAt(0));
+ *   ...
+ *   remote.observe();
+ *
+ * @param menu the menu to control
+ * @param stream the stream requests are read from and responses written to
+ */
+class RemoteControl : public InputInterface {
+  public:
+    static const uint8_t REQUEST_SYNC = 0xA5;
+    static const uint8_t RESPONSE_SYNC = 0x5A;
+    static const uint8_t RECORD_SIZE = 6;
+
+    enum Operation : uint8_t {
+        GET = 'G',
+        SET = 'S',
+        KEY = 'K'
+    };
+
+    enum Address : uint8_t {
+        BY_POSITION = 'P',
+        BY_ID = 'I'
+    };
+
+    enum Status : uint8_t {
+        OK = 0,
+        /**
+         * @brief No item at the address.
+         */
+        NO_ITEM,
+        /**
+         * @brief The item has no widget at that index.
+         */
+        NO_WIDGET,
+        /**
+         * @brief The widget's value is not a number.
+         */
+        NOT_A_NUMBER,
+        /**
+         * @brief The request failed its checksum.
+         */
+        BAD_CHECKSUM,
+        /**
+         * @brief The payload is not a list of valid operations.
+         */
+        MALFORMED,
+        /**
+         * @brief The payload does not fit `REMOTE_CONTROL_FRAME_SIZE`.
+         */
+        TOO_LONG
+    };
+
+    /**
+     * @brief Add `byte` to a CRC-8 (polynomial 0x07).
+     */
+    static uint8_t crc8(uint8_t crc, uint8_t byte);
+
+  private:
+    enum State : uint8_t {
+        WAIT_SYNC,
+        WAIT_LENGTH,
+        WAIT_PAYLOAD,
+        WAIT_CHECKSUM,
+        SKIP_PAYLOAD
+    };
+
+    struct Binding {
+        uint16_t id;
+        MenuItem* item;
+    };
+
+    Stream* stream;
+    MenuScreen* screens[REMOTE_CONTROL_SCREENS] = {};
+    Binding bindings[REMOTE_CONTROL_BINDINGS] = {};
+    uint8_t screenCount = 0;
+    uint8_t bindingCount = 0;
+
+    uint8_t frame[REMOTE_CONTROL_FRAME_SIZE];
+    uint8_t length = 0;
+    uint8_t received = 0;
+    uint8_t crc = 0;
+    State state = WAIT_SYNC;
+    unsigned long lastByteTime = 0;
+
+    void receive(uint8_t byte);
+    uint8_t countOperations();
+    MenuItem* findItem(const uint8_t* address);
+    void execute();
+    void respond(Status status);
+    void sendRecord(Status status, const WidgetNumber& number);
+    void send(uint8_t byte);
+
+  public:
+    RemoteControl(LcdMenu* menu, Stream* stream) : InputInterface(menu), stream(stream) {}
+
+    /**
+     * @brief Make `screen` addressable by number.
+     * @return the screen's number, `0` if there is no room left
+     */
+    uint8_t addScreen(MenuScreen* screen);
+    /**
+     * @brief Make `item` addressable by `id`, replacing a previous binding of `id`.
+     * IDs stay valid when items are added to or moved between screens.
+     * @return `false` if there is no room left
+     */
+    bool bind(uint16_t id, MenuItem* item);
+    /**
+     * @brief Read the available bytes and execute complete requests.
+     */
+    void observe() override;
+};
@@ -6,6 +6,7 @@ struct RepeatState {
     unsigned long pressStart = 0;
     unsigned long lastRepeat = 0;
     unsigned long lastPress = 0;
+    bool repeating = false;
 
     RepeatState(unsigned long d = 0, unsigned long i = 0)
         : delay(d), interval(i) {}
@@ -16,12 +17,14 @@ struct RepeatState {
         pressStart = 0;
         lastRepeat = 0;
         lastPress = 0;
+        repeating = false;
     }
 
     void start(unsigned long now) {
         pressStart = now;
         lastRepeat = 0;
         lastPress = now;
+        repeating = false;
     }
 
     bool startIfDebounced(unsigned long now, unsigned long debounceTime) {
@@ -37,7 +40,9 @@ struct RepeatState {
     bool shouldRepeat(unsigned long now) {
         if (!enabled()) return false;
         if (now - pressStart >= delay &&
-            (lastRepeat == 0 || now - lastRepeat >= interval)) {
+            (!repeating || now - lastRepeat >= interval)) {
+            // A flag rather than `lastRepeat == 0`, the clock can wrap to 0
+            repeating = true;
             lastRepeat = now;
             lastPress = now;
             return true;
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "InputInterface.h"
+#include "InputRecording.h"
+
+/**
+ * @class ReplayAdapter
+ * @brief Plays an `InputRecording` back into the menu.
+ *
+ * In `REAL_TIME` mode every command is sent after its recorded delay, which
+ * reproduces what the operator did. In `FULL_SPEED` mode one command is sent
+ * per `observe` call, ignoring the delays.
+ *
+ * `replayAll` sends all remaining commands at once and returns the time it
+ * took, which gives the highest command rate the menu sustains on a board.
+ *
+ * @example
+ *   ReplayAdapter replay(&menu, &recording, ReplayAdapter::FULL_SPEED);
+ *   replay.play();
+ *   unsigned long us = replay.replayAll();
+ *   Serial.println(recording.size() * 1000000.0 / us);
+ *
+ * @param menu the menu to control
+ * @param recording the commands to play
+ * @param mode `REAL_TIME` or `FULL_SPEED`
+ */
+class ReplayAdapter : public InputInterface {
+  public:
+    enum Mode : uint8_t {
+        REAL_TIME,
+        FULL_SPEED
+    };
+
+  private:
+    const InputRecording* recording;
+    Mode mode;
+    uint16_t position = 0;
+    unsigned long lastTime = 0;
+    bool playing = false;
+    bool looping = false;
+
+    void next() {
+        dispatch(recording->getCommand(position++));
+        if (position == recording->size()) {
+            if (looping) {
+                position = 0;
+            } else {
+                playing = false;
+            }
+        }
+    }
+
+  public:
+    ReplayAdapter(LcdMenu* menu, const InputRecording* recording, Mode mode = REAL_TIME)
+        : InputInterface(menu), recording(recording), mode(mode) {}
+
+    /**
+     * @brief Start playing from the first command.
+     */
+    void play() {
+        position = 0;
+        lastTime = now();
+        playing = recording->size() > 0;
+    }
+    /**
+     * @brief Stop playing, `play` starts over.
+     */
+    void stop() { playing = false; }
+    bool isPlaying() const { return playing; }
+    /**
+     * @brief Start over after the last command instead of stopping.
+     */
+    void setLoop(bool looping) { this->looping = looping; }
+    void setMode(Mode mode) { this->mode = mode; }
+    /**
+     * @brief Index of the next command to play.
+     */
+    uint16_t getPosition() const { return position; }
+
+    void observe() override {
+        TRACE_DRAIN();
+        if (!playing) {
+            return;
+        }
+        if (mode == FULL_SPEED) {
+            next();
+            return;
+        }
+        // Commands that became due while the loop was busy are sent at once,
+        // at most one pass over the recording so a looping one cannot hang
+        unsigned long time = now();
+        for (uint16_t sent = 0; playing && sent < recording->size(); sent++) {
+            uint16_t delay = recording->getDelay(position);
+            if (time - lastTime < delay) break;
+            lastTime += delay;
+            next();
+        }
+    }
+    /**
+     * @brief Send all remaining commands without delay.
+     * Stops when the last command is sent, even when looping.
+     * @return the time it took in microseconds
+     */
+    unsigned long replayAll() {
+        unsigned long start = micros();
+        while (playing && position < recording->size()) {
+            dispatch(recording->getCommand(position++));
+        }
+        playing = false;
+        return micros() - start;
+    }
+};
@@ -58,22 +58,23 @@ class SimpleRotaryAdapter : public InputInterface {
     }
 
     void observe() override {
+        TRACE_DRAIN();
         // Handle rotary encoder rotation
         uint8_t rotation = encoder->rotate();
         if (rotation == 1) {
-            menu->process(DOWN);  // Call DOWN action
+            dispatch(DOWN);  // Call DOWN action
         } else if (rotation == 2) {
-            menu->process(UP);  // Call UP action
+            dispatch(UP);  // Call UP action
         }
 
         // Handle button press (short, long, and double press)
         uint8_t pressType = encoder->pushType(LONG_PRESS_DURATION);
-        unsigned long currentTime = millis();
+        unsigned long currentTime = now();
 
         if (pressType == 1) {
             if (pendingEnter) {
                 if (DOUBLE_PRESS_THRESHOLD > 0 && currentTime - lastPressTime < DOUBLE_PRESS_THRESHOLD) {
-                    menu->process(BACKSPACE);  // Call BACKSPACE action (double press)
+                    dispatch(BACKSPACE);  // Call BACKSPACE action (double press)
                     pendingEnter = false;
                 }
             } else {
@@ -81,14 +82,14 @@ class SimpleRotaryAdapter : public InputInterface {
                 lastPressTime = currentTime;
             }
         } else if (pressType == 2) {
-            menu->process(BACK);  // Call BACK action (long press)
+            dispatch(BACK);  // Call BACK action (long press)
             pendingEnter = false;
         }
 
         // Check if the doublePressThreshold has elapsed for pending enter action
-        if ((!MenuItem::isEditing() && pendingEnter) ||
+        if ((!menu->isEditing() && pendingEnter) ||
             (pendingEnter && (currentTime - lastPressTime >= DOUBLE_PRESS_THRESHOLD))) {
-            menu->process(ENTER);  // Call ENTER action (short press)
+            dispatch(ENTER);  // Call ENTER action (short press)
             pendingEnter = false;
         }
     }
@@ -1,6 +1,9 @@
 #include "CharacterDisplayRenderer.h"
 #include "MenuItem.h"
 
+const uint8_t CharacterDisplayRenderer::firstFreeSlot;
+
+#if LCDMENU_SCROLL_INDICATORS
 CharacterDisplayRenderer::CharacterDisplayRenderer(
     CharacterDisplayInterface* display,
     const uint8_t maxCols,
@@ -20,22 +23,47 @@ CharacterDisplayRenderer::~CharacterDisplayRenderer() {
     delete[] upArrow;
     delete[] downArrow;
 }
+#else
+CharacterDisplayRenderer::CharacterDisplayRenderer(
+    CharacterDisplayInterface* display,
+    const uint8_t maxCols,
+    const uint8_t maxRows,
+    const uint8_t cursorIcon,
+    const uint8_t editCursorIcon)
+    : MenuRenderer(display, maxCols, maxRows),
+      cursorIcon(cursorIcon),
+      editCursorIcon(editCursorIcon),
+      availableColumns(maxCols) {}
+
+CharacterDisplayRenderer::~CharacterDisplayRenderer() {}
+#endif
+
+void CharacterDisplayRenderer::report(MemoryReport& report) {
+    report.add(MemoryReport::RENDERER, sizeof(*this));
+#if LCDMENU_SCROLL_INDICATORS
+    if (upArrow != NULL) report.add(MemoryReport::RENDERER, 8, 0);
+    if (downArrow != NULL) report.add(MemoryReport::RENDERER, 8, 0);
+#endif
+}
 
 void CharacterDisplayRenderer::begin() {
     MenuRenderer::begin();
+#if LCDMENU_SCROLL_INDICATORS
     if (upArrow != NULL && downArrow != NULL) {
         static_cast<CharacterDisplayInterface*>(display)->createChar(0, upArrow);
         static_cast<CharacterDisplayInterface*>(display)->createChar(1, downArrow);
     }
+#endif
+    if (barSlot != 0) uploadBarGlyphs();
 }
 
 void CharacterDisplayRenderer::drawItem(const char* text, const char* value, bool padWithBlanks) {
     uint8_t cursorCol = 0;
-    display->setCursor(cursorCol, cursorRow);
+    display->setCursor(cursorCol, cursorRow + rowOffset);
 
     // Draw cursor or empty space based on focus and edit mode
     if (cursorIcon != 0 || editCursorIcon != 0) {
-        display->draw(hasFocus ? (MenuItem::isEditing() ? editCursorIcon : cursorIcon) : ' ');
+        display->draw(hasFocus ? (isEditing() ? editCursorIcon : cursorIcon) : ' ');
         cursorCol++;
     }
 
@@ -49,10 +77,13 @@ void CharacterDisplayRenderer::drawItem(const char* text, const char* value, boo
     }
 
     // Draw value if present
+    valueCol = cursorCol;
+    valueWidth = 0;
     if (value) {
         uint8_t textLen = strlen(text);
         uint8_t valueViewShift = (viewShift > textLen) ? viewShift - textLen - 1 : 0;
         drawText(value, cursorCol, valueViewShift);
+        if (!hasFocus || valueViewShift == 0) valueWidth = cursorCol - valueCol;
     }
 
     uint8_t cursorColEnd = cursorCol;
@@ -64,12 +95,14 @@ void CharacterDisplayRenderer::drawItem(const char* text, const char* value, boo
         }
     }
 
+#if LCDMENU_SCROLL_INDICATORS
     // Draw up and down arrows if present
     if (upArrow && downArrow) {
         uint8_t indicator = hasHiddenItemsAbove ? 0 : (hasHiddenItemsBelow ? 1 : ' ');
-        display->setCursor(maxCols - 1, cursorRow);
+        display->setCursor(maxCols - 1, cursorRow + rowOffset);
         display->draw(indicator);
     }
+#endif
 
     // Move cursor to the end position if focused
     if (hasFocus) moveCursor(cursorColEnd, cursorRow);
@@ -107,7 +140,59 @@ void CharacterDisplayRenderer::clearBlinker() {
 
 void CharacterDisplayRenderer::moveCursor(uint8_t cursorCol, uint8_t cursorRow) {
     MenuRenderer::moveCursor(cursorCol, cursorRow);
-    display->setCursor(cursorCol, cursorRow);
+    display->setCursor(cursorCol, cursorRow + rowOffset);
+}
+
+void CharacterDisplayRenderer::setAnimation(uint8_t slot, const uint8_t (*frames)[8], uint8_t frameCount, uint16_t interval) {
+    if (slot < firstFreeSlot || slot > 7) return;
+    animationSlot = slot;
+    animationFrames = frameCount != 0 ? frames : NULL;
+    animationFrameCount = frameCount;
+    animationInterval = interval;
+    animationFrame = 0;
+    animationShownAt = clock->now();
+    if (animationFrames != NULL) uploadFrame();
+}
+
+void CharacterDisplayRenderer::stopAnimation() {
+    animationFrames = NULL;
+}
+
+void CharacterDisplayRenderer::animate() {
+    if (animationFrames == NULL || powerState == OFF) return;
+    unsigned long now = clock->now();
+    if (now - animationShownAt < animationInterval) return;
+    animationShownAt = now;
+    animationFrame = (animationFrame + 1) % animationFrameCount;
+    uploadFrame();
+}
+
+void CharacterDisplayRenderer::uploadFrame() {
+    uint8_t frame[8];
+    memcpy(frame, animationFrames[animationFrame], sizeof(frame));
+    static_cast<CharacterDisplayInterface*>(display)->createChar(animationSlot, frame);
+    // The display now points at the glyph memory, only the blinker needs it back
+    if (isEditing()) moveCursor(cursorCol, cursorRow);
+}
+
+void CharacterDisplayRenderer::setBarGlyphs(uint8_t firstSlot) {
+    // The 4 glyphs must fit in the free slots, up to slot 7
+    barSlot = firstSlot >= firstFreeSlot && firstSlot <= 4 ? firstSlot : 0;
+    if (barSlot != 0) uploadBarGlyphs();
+}
+
+void CharacterDisplayRenderer::uploadBarGlyphs() {
+    uint8_t glyph[8];
+    for (uint8_t columns = 1; columns < 5; columns++) {
+        // Filled from the left, the leftmost pixel is the highest of the 5 bits
+        memset(glyph, (0x1F << (5 - columns)) & 0x1F, sizeof(glyph));
+        static_cast<CharacterDisplayInterface*>(display)->createChar(barSlot + columns - 1, glyph);
+    }
+}
+
+uint8_t CharacterDisplayRenderer::getBarGlyph(uint8_t columns) const {
+    if (barSlot == 0 || columns == 0 || columns >= 5) return MenuRenderer::getBarGlyph(columns);
+    return barSlot + columns - 1;
 }
 
 uint8_t CharacterDisplayRenderer::getEffectiveCols() const {
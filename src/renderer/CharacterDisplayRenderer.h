@@ -1,5 +1,6 @@
 #pragma once
 
+#include "LcdMenuConfig.h"
 #include "MenuRenderer.h"
 #include "display/CharacterDisplayInterface.h"
 
@@ -18,14 +19,45 @@
  *
  * @note
  * The class uses dynamic memory allocation for the upArrow and downArrow icons.
+ * With `LCDMENU_SCROLL_INDICATORS` off it has no arrows and its constructor
+ * takes no arrow icons.
  */
 class CharacterDisplayRenderer : public MenuRenderer {
   protected:
+#if LCDMENU_SCROLL_INDICATORS
     uint8_t* upArrow;
     uint8_t* downArrow;
+#endif
     const uint8_t cursorIcon;
     const uint8_t editCursorIcon;
     const uint8_t availableColumns;
+    const uint8_t (*animationFrames)[8] = NULL;
+    uint16_t animationInterval = 0;
+    unsigned long animationShownAt = 0;
+    uint8_t animationSlot = 0;
+    uint8_t animationFrameCount = 0;
+    uint8_t animationFrame = 0;
+    /**
+     * @brief First of the 4 slots of the partial bar glyphs, `0` when they are not used.
+     */
+    uint8_t barSlot = 0;
+    /**
+     * @brief First custom character slot free for glyphs: slot 0 would end the texts
+     * it is put in, slot 1 holds the down arrow.
+     */
+#if LCDMENU_SCROLL_INDICATORS
+    static const uint8_t firstFreeSlot = 2;
+#else
+    static const uint8_t firstFreeSlot = 1;
+#endif
+    /**
+     * @brief Upload the current frame of the animation to its slot.
+     */
+    void uploadFrame();
+    /**
+     * @brief Upload the glyphs of the cells filled 1 to 4 columns to the bar slots.
+     */
+    void uploadBarGlyphs();
     /**
      * @brief Calculates the available horizontal space for displaying content.
      *
@@ -72,9 +104,13 @@ class CharacterDisplayRenderer : public MenuRenderer {
         const uint8_t maxCols,
         const uint8_t maxRows,
         const uint8_t cursorIcon = 0x7E,
+#if LCDMENU_SCROLL_INDICATORS
         const uint8_t editCursorIcon = 0x7F,
         uint8_t* upArrow = new uint8_t[8]{0x04, 0x0E, 0x1F, 0x04, 0x04, 0x04, 0x04, 0x04},
         uint8_t* downArrow = new uint8_t[8]{0x04, 0x04, 0x04, 0x04, 0x04, 0x1F, 0x0E, 0x04});
+#else
+        const uint8_t editCursorIcon = 0x7F);
+#endif
 
     /**
      * @brief Destructor.
@@ -101,8 +137,47 @@ class CharacterDisplayRenderer : public MenuRenderer {
      * @param padWithBlanks A flag indicating whether to pad the text with spaces.
      */
     void drawItem(const char* text, const char* value, bool padWithBlanks) override;
+    using MenuRenderer::drawItem;
     void draw(uint8_t byte) override;
     void drawBlinker() override;
     void clearBlinker() override;
     void moveCursor(uint8_t cursorCol, uint8_t cursorRow) override;
+    /**
+     * @brief Animate custom character `slot` by uploading the next of `frames` every `interval` milliseconds.
+     *
+     * Every cell that shows the character changes at once, so a frame costs one
+     * `createChar`, 9 bytes, however many cells show it. Frames advance on
+     * `LcdMenu::poll` and not while the display is off. Put the character in a
+     * text to show it, e.g. `"Saving \x02"` for slot 2.
+     *
+     * @note slots 0 and 1 are reserved for the arrow icons, slot 0 cannot be used
+     * even without them. A call with another slot is ignored.
+     *
+     * @param slot the custom character slot, 2 to 7, 1 to 7 with `LCDMENU_SCROLL_INDICATORS` off
+     * @param frames the frames, 8 rows each, they must outlive the animation
+     * @param frameCount the number of frames
+     * @param interval milliseconds between two frames
+     */
+    void setAnimation(uint8_t slot, const uint8_t (*frames)[8], uint8_t frameCount, uint16_t interval = 200);
+    /**
+     * @brief Stop the animation, the slot keeps its current frame.
+     */
+    void stopAnimation();
+    void animate() override;
+    /**
+     * @brief Use 4 custom characters for the cells of `ItemBar` filled 1 to 4 of their 5 columns.
+     * Without them a cell is shown full or empty. `begin` sends them again.
+     *
+     * @note slots 0 and 1 are reserved for the arrow icons, slot 0 cannot be used
+     * even without them. Another first slot stops using the glyphs.
+     *
+     * @param firstSlot the first of the 4 slots, 2 to 4, 1 to 4 with `LCDMENU_SCROLL_INDICATORS` off,
+     *        `0` to stop using them
+     */
+    void setBarGlyphs(uint8_t firstSlot = 3);
+    uint8_t getBarGlyph(uint8_t columns) const override;
+    /**
+     * @brief Add the renderer and its arrow glyphs to the report.
+     */
+    void report(MemoryReport& report) override;
 };
@@ -1,11 +1,60 @@
 #include "MenuRenderer.h"
 
+#if !LCDMENU_VIEW_SHIFT
+const uint8_t MenuRenderer::viewShift;
+#endif
+
 MenuRenderer::MenuRenderer(DisplayInterface* display, uint8_t maxCols, uint8_t maxRows)
-    : maxCols(maxCols), maxRows(maxRows), display(display) {}
+    : maxCols(maxCols), maxRows(maxRows), displayRows(maxRows), display(display) {}
+
+MenuRenderer::~MenuRenderer() {
+    endEdit();
+}
+
+MenuRenderer* MenuRenderer::firstEditing = NULL;
+bool MenuRenderer::sharedEditing = false;
+
+void MenuRenderer::beginEdit() {
+    if (editing) return;
+    editing = true;
+    nextEditing = firstEditing;
+    firstEditing = this;
+}
+
+void MenuRenderer::endEdit() {
+    if (!editing) return;
+    editing = false;
+    editedItem = NULL;
+    MenuRenderer** link = &firstEditing;
+    while (*link != this) link = &(*link)->nextEditing;
+    *link = nextEditing;
+    nextEditing = NULL;
+}
+
+bool MenuRenderer::isAnyEditing() {
+    return firstEditing != NULL || sharedEditing;
+}
+
+MenuRenderer* MenuRenderer::findEditor(const MenuItem* item, const MenuRenderer* renderer) {
+    for (MenuRenderer* editor = firstEditing; editor != NULL; editor = editor->nextEditing) {
+        if (editor != renderer && editor->editedItem == item) return editor;
+    }
+    return NULL;
+}
 
 void MenuRenderer::begin() {
     display->begin();
-    startTime = millis();
+    startTime = clock->now();
+    powerState = ACTIVE;
+}
+
+void MenuRenderer::drawMessage(uint8_t row, const char* text) {
+    uint8_t length = strlen(text) < maxCols ? strlen(text) : maxCols;
+    uint8_t padding = (maxCols - length) / 2;
+    display->setCursor(0, row + rowOffset);
+    for (uint8_t col = 0; col < maxCols; col++) {
+        display->draw(col >= padding && col < padding + length ? static_cast<uint8_t>(text[col - padding]) : ' ');
+    }
 }
 
 void MenuRenderer::moveCursor(uint8_t cursorCol, uint8_t cursorRow) {
@@ -14,14 +63,84 @@ void MenuRenderer::moveCursor(uint8_t cursorCol, uint8_t cursorRow) {
 }
 
 void MenuRenderer::restartTimer() {
-    this->startTime = millis();
-    display->show();
+    wake();
+}
+
+bool MenuRenderer::wake() {
+    startTime = clock->now();
+    PowerState previous = powerState;
+    setPowerState(ACTIVE);
+    return (previous == OFF && wakePolicy != PROCESS_WAKING_INPUT) ||
+           (previous == DIMMED && wakePolicy == SWALLOW_WHEN_ASLEEP);
 }
 
+void MenuRenderer::updateTimer() {
+    unsigned long idle = clock->now() - startTime;
+    if (offTimeout != 0 && idle >= offTimeout) {
+        setPowerState(OFF);
+    } else if (dimTimeout != 0 && idle >= dimTimeout && powerState == ACTIVE) {
+        setPowerState(DIMMED);
+    }
+}
+
+void MenuRenderer::setPowerState(PowerState state) {
+    if (state == powerState) {
+        return;
+    }
+    switch (state) {
+        case ACTIVE:
+            if (powerState == OFF) {
+                display->show();
+            } else {
+                display->setBacklight(true);
+            }
+            LOG(F("MenuRenderer::wake"));
+            break;
+        case DIMMED:
+            display->setBacklight(false);
+            LOG(F("MenuRenderer::dim"));
+            break;
+        case OFF:
+            display->hide();
+            LOG(F("MenuRenderer::timeout"));
+            break;
+    }
+    powerState = state;
+}
+
+void MenuRenderer::setPowerTimeouts(unsigned long dimTimeout, unsigned long offTimeout) {
+    this->dimTimeout = dimTimeout;
+    this->offTimeout = offTimeout;
+}
+
+void MenuRenderer::setWakePolicy(WakePolicy policy) { wakePolicy = policy; }
+
+MenuRenderer::PowerState MenuRenderer::getPowerState() const { return powerState; }
+
 uint8_t MenuRenderer::getCursorCol() const { return cursorCol; }
 
 uint8_t MenuRenderer::getCursorRow() const { return cursorRow; }
 
+uint8_t MenuRenderer::getValueCol() const { return valueCol; }
+
+uint8_t MenuRenderer::getValueWidth() const { return valueWidth; }
+
 uint8_t MenuRenderer::getMaxRows() const { return maxRows; }
 
+void MenuRenderer::setViewport(uint8_t firstRow, uint8_t rows) {
+    rowOffset = firstRow < displayRows ? firstRow : displayRows - 1;
+    uint8_t left = displayRows - rowOffset;
+    maxRows = rows == 0 ? 1 : (rows < left ? rows : left);
+}
+
+uint8_t MenuRenderer::getRowOffset() const { return rowOffset; }
+
 uint8_t MenuRenderer::getMaxCols() const { return maxCols; }
+
+void MenuRenderer::setProfiler(RenderProfiler* profiler) { this->profiler = profiler; }
+
+RenderProfiler* MenuRenderer::getProfiler() const { return profiler; }
+
+void MenuRenderer::setClock(Clock* clock) { this->clock = clock != NULL ? clock : &systemClock(); }
+
+Clock* MenuRenderer::getClock() const { return clock; }
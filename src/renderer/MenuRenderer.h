@@ -1,10 +1,36 @@
 #ifndef MENU_RENDERER_H
 #define MENU_RENDERER_H
 
+#include "LcdMenuConfig.h"
+#include "diagnostics/MemoryReport.h"
+#include "diagnostics/RenderProfiler.h"
 #include "display/DisplayInterface.h"
 #include <Arduino.h>
+#include <utils/lcd_menu_clock.h>
+#include <utils/lcd_menu_constants.h>
+#include <utils/lcd_menu_text.h>
 #include <utils/lcd_menu_utils.h>
 
+/**
+ * Number of rows whose poll times are kept. Rows below share one poll time,
+ * they are polled at the menu's interval and redrawn together when dirty.
+ */
+#ifndef POLL_MAX_ROWS
+#ifdef __AVR__
+#define POLL_MAX_ROWS 4
+#else
+#define POLL_MAX_ROWS 8
+#endif
+#endif
+
+/**
+ * Most rows redrawn by one call of `LcdMenu::poll`.
+ * Rows that are due together are spread over the next calls.
+ */
+#ifndef POLL_ROWS_PER_TICK
+#define POLL_ROWS_PER_TICK 2
+#endif
+
 /**
  * @class MenuRenderer
  * @brief Abstract base class for rendering a menu on a display.
@@ -12,13 +38,61 @@
  * This class provides the basic structure and functionality for rendering a menu
  * on a display. It includes methods for drawing items, moving the cursor, and
  * handling edit mode.
+ *
+ * It also manages the power of the display: after a period without input the
+ * display goes from `ACTIVE` to `DIMMED` (backlight off) and then to `OFF`,
+ * see `setPowerTimeouts`. Each change of state is sent to the display once.
  */
 class MenuRenderer {
     friend class MenuScreen;
+    friend class MenuItem;
+
+  public:
+    enum PowerState : uint8_t {
+        /**
+         * @brief Display and backlight on.
+         */
+        ACTIVE,
+        /**
+         * @brief Display on, backlight off.
+         */
+        DIMMED,
+        /**
+         * @brief Display and backlight off.
+         */
+        OFF
+    };
+
+    enum WakePolicy : uint8_t {
+        /**
+         * @brief The input that wakes the display is processed.
+         */
+        PROCESS_WAKING_INPUT,
+        /**
+         * @brief The input that wakes the display from `OFF` is ignored.
+         */
+        SWALLOW_WHEN_OFF,
+        /**
+         * @brief The input that wakes the display from `DIMMED` or `OFF` is ignored.
+         */
+        SWALLOW_WHEN_ASLEEP
+    };
 
   protected:
     const uint8_t maxCols;
-    const uint8_t maxRows;
+    /**
+     * @brief Number of rows of the menu, all the rows of the display unless set with `setViewport`.
+     */
+    uint8_t maxRows;
+    /**
+     * @brief Number of rows of the display.
+     */
+    const uint8_t displayRows;
+    /**
+     * @brief Row of the display the menu starts at, see `setViewport`.
+     * `cursorRow` and the rows given to the drawing functions count from it.
+     */
+    uint8_t rowOffset = 0;
 
     /**
      * @brief Flag indicating that there are hidden items above the current view.
@@ -36,14 +110,92 @@ class MenuRenderer {
 
     uint8_t cursorCol;
     uint8_t cursorRow;
+    /**
+     * @brief Column the value of the last item drawn starts at, and how many of its characters are shown.
+     * The width is `0` when the value is not shown from its first character, see `getValueCol`.
+     */
+    uint8_t valueCol = 0;
+    uint8_t valueWidth = 0;
 
+    /**
+     * @brief Time of the last input, see `wake`.
+     */
     unsigned long startTime = 0;
 
+    PowerState powerState = ACTIVE;
+    WakePolicy wakePolicy = PROCESS_WAKING_INPUT;
+    /**
+     * @brief Milliseconds without input before dimming, `0` to never dim.
+     */
+    unsigned long dimTimeout = 0;
+    /**
+     * @brief Milliseconds without input before turning off, `0` to never turn off.
+     */
+    unsigned long offTimeout = DISPLAY_TIMEOUT;
+
+    /**
+     * @brief Send the change to `state` to the display.
+     */
+    void setPowerState(PowerState state);
+
+    /**
+     * @brief Time each row was last drawn, see `MenuScreen::poll`.
+     * Set whenever a row is drawn, so an item scrolled into a row is due one of its own intervals later.
+     * The last entry is shared by the rows past `POLL_MAX_ROWS`.
+     */
+    unsigned long lastPollTimes[POLL_MAX_ROWS + 1] = {};
+    /**
+     * @brief Revision of the item drawn on each row, see `MenuItem::markDirty`.
+     * The last entry is the sum of the revisions of the rows past `POLL_MAX_ROWS`.
+     */
+    uint8_t drawnRevisions[POLL_MAX_ROWS + 1] = {};
+
+    /**
+     * @brief The focused item is being edited, see `beginEdit`.
+     */
+    bool editing = false;
+    /**
+     * @brief Item being edited, set by `MenuScreen::process` after the item began the edit.
+     */
+    MenuItem* editedItem = NULL;
+    /**
+     * @brief Next renderer being edited, the renderers being edited are linked from `firstEditing`.
+     */
+    MenuRenderer* nextEditing = NULL;
+    static MenuRenderer* firstEditing;
+    /**
+     * @brief Set by the deprecated `MenuItem::beginEdit`, every renderer is then being edited.
+     */
+    static bool sharedEditing;
+
+    /**
+     * @brief Find the renderer, other than `renderer`, that is editing `item`.
+     * The edit state of an item, like the cursor of `ItemInput`, is kept by the item
+     * once, so a single renderer may edit it at a time.
+     * @return the renderer editing the item, `NULL` if none
+     */
+    static MenuRenderer* findEditor(const MenuItem* item, const MenuRenderer* renderer);
+
+    /**
+     * @brief Clock used for the display timeout, polling and the input adapters.
+     */
+    Clock* clock = &systemClock();
+
+    /**
+     * @brief Optional profiler attributing draw and process costs to items.
+     */
+    RenderProfiler* profiler = NULL;
+
   public:
     /**
      * @brief Number of columns to shift the current item's view by.
+     * Always `0` when `LCDMENU_VIEW_SHIFT` is off.
      */
+#if LCDMENU_VIEW_SHIFT
     uint8_t viewShift = 0;
+#else
+    static const uint8_t viewShift = 0;
+#endif
 
     /**
      * Pointer to the display interface used for rendering.
@@ -57,6 +209,26 @@ class MenuRenderer {
      * @param maxRows Maximum number of rows in the display.
      */
     MenuRenderer(DisplayInterface* display, uint8_t maxCols, uint8_t maxRows);
+    ~MenuRenderer();
+
+    /**
+     * @brief Check if the focused item of this renderer is being edited.
+     * Each menu, and so each display, has its own edit state.
+     */
+    bool isEditing() const { return editing || sharedEditing; }
+    /**
+     * @brief Start editing the focused item.
+     * Polling is paused on this renderer until `endEdit`.
+     */
+    void beginEdit();
+    /**
+     * @brief Stop editing the focused item.
+     */
+    void endEdit();
+    /**
+     * @brief Check if an item is being edited on any renderer.
+     */
+    static bool isAnyEditing();
 
     /**
      * @brief Initializes the display and starts the timer.
@@ -77,6 +249,23 @@ class MenuRenderer {
      */
     virtual void drawItem(const char* text, const char* value, bool padWithBlanks = true) = 0;
 
+    /**
+     * @brief Draws an item whose text may be in flash.
+     * A text in flash is copied to the stack for the time it is drawn.
+     */
+    void drawItem(const MenuText& text, const char* value, bool padWithBlanks = true) {
+        char buffer[ITEM_DRAW_BUFFER_SIZE];
+        drawItem(text.load(buffer, sizeof(buffer)), value, padWithBlanks);
+    }
+
+    /**
+     * @brief Draw a line of a message centered on `row`, blanking the rest of the row.
+     * Used for the messages shown over the menu, see `LcdMenu::showOverlay`.
+     * @param row the row to draw on
+     * @param text the line, cut to the width of the display
+     */
+    virtual void drawMessage(uint8_t row, const char* text);
+
     /**
      * @brief Function to clear the blinker from the display.
      */
@@ -100,15 +289,41 @@ class MenuRenderer {
     virtual void restartTimer();
 
     /**
-     * @brief Updates the display timer and hides the display if the timeout is reached.
+     * @brief Restart the display timer and wake the display up.
+     * @return `true` if the input that woke the display should be ignored, see `setWakePolicy`
      */
-    virtual void updateTimer() {
-        if (millis() - startTime < DISPLAY_TIMEOUT) {
-            return;
-        }
-        LOG(F("MenuRenderer::timeout"));
-        display->hide();
-    }
+    bool wake();
+
+    /**
+     * @brief Dims or turns off the display once its timeout is reached.
+     * Does nothing, and sends nothing to the display, until the next change of state.
+     */
+    virtual void updateTimer();
+
+    /**
+     * @brief Advance the renderer's animations, called on every `LcdMenu::poll`.
+     */
+    virtual void animate() {}
+
+    /**
+     * @brief Set the time without input after which the display dims and turns off.
+     * Both are counted from the last input, `0` disables the state.
+     * The defaults are no dimming and `DISPLAY_TIMEOUT` to turn off.
+     * @param dimTimeout milliseconds before the backlight is turned off
+     * @param offTimeout milliseconds before the display is turned off
+     */
+    void setPowerTimeouts(unsigned long dimTimeout, unsigned long offTimeout);
+
+    /**
+     * @brief Choose whether the input that wakes the display is processed.
+     * @param policy the policy, `PROCESS_WAKING_INPUT` by default
+     */
+    void setWakePolicy(WakePolicy policy);
+
+    /**
+     * @brief Gets the power state of the display.
+     */
+    PowerState getPowerState() const;
 
     /**
      * @brief Gets the current column position of the cursor.
@@ -123,11 +338,44 @@ class MenuRenderer {
     uint8_t getCursorRow() const;
 
     /**
-     * @brief Gets the maximum number of rows in the display.
-     * @return Maximum number of rows.
+     * @brief Gets the column the value of the last item drawn starts at.
+     * Lets an item redraw part of its value in place, see `MenuItem::update`.
+     */
+    uint8_t getValueCol() const;
+
+    /**
+     * @brief Gets how many characters of the value of the last item drawn are shown.
+     * @return the width, `0` when the value is scrolled or there is none
+     */
+    uint8_t getValueWidth() const;
+
+    /**
+     * @brief Gets the character of a bar cell with `columns` of its 5 pixel columns filled, see `ItemBar`.
+     * Renderers without partial glyphs show a cell full from 3 columns.
+     * @param columns the filled columns, 0 to 5
+     */
+    virtual uint8_t getBarGlyph(uint8_t columns) const { return columns >= 3 ? 0xFF : ' '; }
+
+    /**
+     * @brief Gets the number of rows of the menu.
+     * @return Maximum number of rows, less than the rows of the display when a viewport is set.
      */
     uint8_t getMaxRows() const;
 
+    /**
+     * @brief Draw the menu on `rows` rows from row `firstRow` only.
+     * The other rows are left to the sketch, for example for a `StatusBar`.
+     * Set it before `LcdMenu::setScreen`.
+     * @param firstRow the first row of the menu
+     * @param rows the number of rows of the menu, cut to the rows left on the display
+     */
+    void setViewport(uint8_t firstRow, uint8_t rows);
+
+    /**
+     * @brief Gets the row of the display the menu starts at.
+     */
+    uint8_t getRowOffset() const;
+
     /**
      * @brief Gets the maximum number of columns in the display.
      * @return Maximum number of columns.
@@ -139,6 +387,36 @@ class MenuRenderer {
      * @return The horizontal space available for displaying content.
      */
     virtual uint8_t getEffectiveCols() const = 0;
+
+    /**
+     * @brief Add the memory taken by this renderer to the report.
+     * @param report the report to add to
+     */
+    virtual void report(MemoryReport& report) { report.add(MemoryReport::RENDERER, sizeof(*this)); }
+
+    /**
+     * @brief Profile every item drawn or processed by the screens with `profiler`.
+     * @param profiler the profiler to use, `NULL` to stop profiling
+     */
+    void setProfiler(RenderProfiler* profiler);
+
+    /**
+     * @brief Gets the attached profiler.
+     * @return the profiler or `NULL`
+     */
+    RenderProfiler* getProfiler() const;
+
+    /**
+     * @brief Use `clock` instead of `millis()` to measure time.
+     * @param clock the clock to use, `NULL` to go back to `millis()`
+     */
+    void setClock(Clock* clock);
+
+    /**
+     * @brief Gets the clock used to measure time.
+     * @return the clock, never `NULL`
+     */
+    Clock* getClock() const;
 };
 
 #endif  // MENU_RENDERER_H
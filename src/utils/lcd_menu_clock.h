@@ -0,0 +1,69 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * @class Clock
+ * @brief Source of milliseconds for everything in the menu that depends on time.
+ *
+ * The renderer owns the clock of a menu, see `MenuRenderer::setClock`. Screens
+ * and input adapters read it through the renderer, so swapping the clock of
+ * the renderer swaps it everywhere. Intervals are always measured as
+ * `now() - start`, which stays correct when the counter wraps.
+ */
+class Clock {
+  public:
+    virtual ~Clock() = default;
+    /**
+     * @brief Milliseconds since an arbitrary start, wrapping like `millis()`.
+     */
+    virtual unsigned long now() = 0;
+};
+
+/**
+ * @class SystemClock
+ * @brief Default clock backed by `millis()`.
+ */
+class SystemClock : public Clock {
+  public:
+    unsigned long now() override { return millis(); }
+};
+
+/**
+ * @brief The `SystemClock` shared by all renderers that were not given another clock.
+ */
+inline SystemClock& systemClock() {
+    static SystemClock clock;
+    return clock;
+}
+
+/**
+ * @class SimulatedClock
+ * @brief Clock that only moves when told to.
+ *
+ * Lets tests and benchmarks fast-forward timeouts, polling and key repeat
+ * without waiting, including the rollover of `millis()` after 49.7 days.
+ * Time is an `unsigned long` like `millis()`, start near `ULONG_MAX` to
+ * test the rollover, `unsigned long` is 64-bit on most hosts.
+ *
+ * @example
+ *   SimulatedClock clock(ULONG_MAX - 500);
+ *   renderer.setClock(&clock);
+ *   clock.advance(1000);  // wraps around
+ */
+class SimulatedClock : public Clock {
+  private:
+    unsigned long time;
+
+  public:
+    SimulatedClock(unsigned long start = 0) : time(start) {}
+    unsigned long now() override { return time; }
+    /**
+     * @brief Jump to `time`.
+     */
+    void set(unsigned long time) { this->time = time; }
+    /**
+     * @brief Move the clock forward by `ms` milliseconds.
+     */
+    void advance(unsigned long ms) { time += ms; }
+};
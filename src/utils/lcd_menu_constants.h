@@ -7,6 +7,11 @@ typedef void (*fptruInt)(uint8_t);
 typedef void (*fptrFloat)(float);
 typedef void (*fptrStr)(char*);
 typedef void (*fptrBool)(bool);
+/**
+ * Size of the buffer an item's value is drawn into, and of the copy of a
+ * text in flash while it is drawn.
+ */
+#define ITEM_DRAW_BUFFER_SIZE 25
 //
 // Control codes
 //
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "lcd_menu_constants.h"
+#include <Arduino.h>
+
+/**
+ * @struct MenuText
+ * @brief A string in RAM or in flash.
+ *
+ * Item texts, widget formats and the texts of booleans are `MenuText`, so
+ * they take a string literal or a string in flash made with `F("...")`.
+ * On AVR, string literals are copied to RAM at startup, strings in flash
+ * are not and are read with the `_P` functions when drawn.
+ *
+ * @example
+ *   ITEM_BASIC(F("Settings"));
+ *   ITEM_RANGE<int>(F("Volume"), 5, 1, 0, 10, callback, F("%d%%"));
+ */
+struct MenuText {
+    const char* text;
+    /**
+     * @brief `true` when `text` is an address in flash.
+     */
+    bool inFlash;
+
+    MenuText() : text(NULL), inFlash(false) {}
+    MenuText(const char* text) : text(text), inFlash(false) {}
+    MenuText(const __FlashStringHelper* text) : text(reinterpret_cast<const char*>(text)), inFlash(true) {}
+
+    bool isNull() const { return text == NULL; }
+
+    size_t length() const {
+        if (text == NULL) return 0;
+        return inFlash ? strlen_P(text) : strlen(text);
+    }
+
+    /**
+     * @brief Length of the text as it is drawn, used to lay out the row.
+     * A text in flash is drawn from a copy of its first `ITEM_DRAW_BUFFER_SIZE - 1`
+     * characters, see `MenuRenderer::drawItem`.
+     */
+    size_t drawnLength() const {
+        size_t len = length();
+        return inFlash && len > ITEM_DRAW_BUFFER_SIZE - 1 ? ITEM_DRAW_BUFFER_SIZE - 1 : len;
+    }
+
+    /**
+     * @brief Get the text in RAM.
+     * @param buffer receives the first `size - 1` characters of a text in flash
+     * @param size the size of `buffer`
+     * @return the text itself when it is in RAM, `buffer` otherwise
+     */
+    const char* load(char* buffer, size_t size) const {
+        if (!inFlash || text == NULL) return text;
+        strncpy_P(buffer, text, size - 1);
+        buffer[size - 1] = '\0';
+        return buffer;
+    }
+
+    /**
+     * @brief Get the character at `index`, wherever the text is stored.
+     */
+    char charAt(size_t index) const {
+        return inFlash ? static_cast<char>(pgm_read_byte(text + index)) : text[index];
+    }
+
+    size_t printTo(Print& out) const {
+        if (text == NULL) return 0;
+        return inFlash ? out.print(reinterpret_cast<const __FlashStringHelper*>(text)) : out.print(text);
+    }
+};
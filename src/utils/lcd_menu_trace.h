@@ -0,0 +1,399 @@
+#ifndef LCD_MENU_TRACE_H
+#define LCD_MENU_TRACE_H
+
+#include "lcd_menu_clock.h"
+#include "lcd_menu_text.h"
+#include <Arduino.h>
+
+/**
+ * Number of events the trace can hold before new events are dropped.
+ * Set it with a build flag so every translation unit agrees on it.
+ */
+#ifndef LCDMENU_TRACE_CAPACITY
+#ifdef __AVR__
+#define LCDMENU_TRACE_CAPACITY 8
+#else
+#define LCDMENU_TRACE_CAPACITY 32
+#endif
+#endif
+
+/**
+ * Bytes kept from mutable (`char*`) string values, including the terminator.
+ */
+#ifndef LCDMENU_TRACE_TEXT_SIZE
+#define LCDMENU_TRACE_TEXT_SIZE 16
+#endif
+
+/**
+ * Size of the buffer holding the frame being sent, longer frames are truncated.
+ */
+#ifndef LCDMENU_TRACE_FRAME_SIZE
+#define LCDMENU_TRACE_FRAME_SIZE 64
+#endif
+
+/**
+ * Number of event names remembered by the binary format.
+ */
+#ifndef LCDMENU_TRACE_NAMES
+#define LCDMENU_TRACE_NAMES 16
+#endif
+
+/**
+ * Where `LOG` sends the trace.
+ */
+#ifndef LCDMENU_TRACE_OUTPUT
+#define LCDMENU_TRACE_OUTPUT Serial
+#endif
+
+#define LCDMENU_TRACE_SYNC 0xA5
+
+/**
+ * @class LcdMenuTrace
+ * @brief Fixed size ring buffer of debug events.
+ *
+ * Each event holds a name stored in flash, a timestamp from the trace's clock
+ * and a small typed value.
+ * Recording an event does not allocate and does not wait for the output;
+ * events are sent by `drain`, which only writes what the output can take
+ * without blocking, or by `flush`, which waits.
+ *
+ * In text format each event is sent as `#LOG# name=value`, the same lines the
+ * Wokwi tests wait for. In binary format an event takes 7 bytes plus its value
+ * and names are sent once, `.scripts/trace_decode.py` turns the binary stream
+ * back into `#LOG#` lines on the host.
+ *
+ * Binary frames, little endian:
+ * - `A5 'D' slot length name...` binds a name to a slot
+ * - `A5 'E' slot type time[4] value...` one event, value is 4 bytes for
+ *   numbers, 1 byte for a char and `length text...` for strings
+ * - `A5 'X' count[2]` number of events dropped because the buffer was full
+ */
+class LcdMenuTrace {
+  public:
+    enum Type : uint8_t {
+        NONE,
+        INT,
+        UINT,
+        FLOAT,
+        CHAR,
+        TEXT,
+    };
+
+  private:
+    struct Event {
+        const __FlashStringHelper* name;
+        unsigned long time;
+        Type type;
+        union {
+            long i;
+            unsigned long u;
+            float f;
+            char c;
+            const char* ref;
+            char text[LCDMENU_TRACE_TEXT_SIZE];
+        } value;
+        // TEXT events point to `ref` when true, own a copy in `text` otherwise
+        bool isRef;
+    };
+
+    /**
+     * @brief Collects one frame before it is written.
+     */
+    class Frame : public Print {
+      public:
+        uint8_t data[LCDMENU_TRACE_FRAME_SIZE];
+        uint8_t length = 0;
+        uint8_t sent = 0;
+        bool truncated = false;
+        size_t write(uint8_t byte) override {
+            if (length == LCDMENU_TRACE_FRAME_SIZE) {
+                truncated = true;
+                return 0;
+            }
+            data[length++] = byte;
+            return 1;
+        }
+        using Print::write;
+        void clear() {
+            length = 0;
+            sent = 0;
+            truncated = false;
+        }
+        bool isSent() const { return sent == length; }
+        void writeLong(unsigned long value) {
+            for (uint8_t i = 0; i < 4; i++) {
+                write((uint8_t)(value >> (8 * i)));
+            }
+        }
+    };
+
+    Event events[LCDMENU_TRACE_CAPACITY];
+    uint8_t head = 0;
+    uint8_t count = 0;
+    uint16_t dropped = 0;
+    bool binary = false;
+    Clock* clock = &systemClock();
+    const __FlashStringHelper* names[LCDMENU_TRACE_NAMES] = {};
+    uint8_t nextName = 0;
+    Frame frame;
+
+    Event* push(const __FlashStringHelper* name, Type type) {
+        if (count == LCDMENU_TRACE_CAPACITY) {
+            if (dropped < 0xFFFF) dropped++;
+            return nullptr;
+        }
+        Event* event = &events[(head + count) % LCDMENU_TRACE_CAPACITY];
+        count++;
+        event->name = name;
+        event->time = clock->now();
+        event->type = type;
+        event->isRef = false;
+        return event;
+    }
+
+    void pushText(const __FlashStringHelper* name, const char* text, bool isRef) {
+        Event* event = push(name, TEXT);
+        if (event == nullptr) return;
+        event->isRef = isRef;
+        if (isRef) {
+            event->value.ref = text;
+        } else if (text == nullptr) {
+            event->value.text[0] = '\0';
+        } else {
+            strncpy(event->value.text, text, LCDMENU_TRACE_TEXT_SIZE - 1);
+            event->value.text[LCDMENU_TRACE_TEXT_SIZE - 1] = '\0';
+        }
+    }
+
+    const char* textOf(const Event& event) const {
+        const char* text = event.isRef ? event.value.ref : event.value.text;
+        return text != nullptr ? text : "";
+    }
+
+    uint8_t slotOf(const __FlashStringHelper* name) {
+        for (uint8_t i = 0; i < LCDMENU_TRACE_NAMES; i++) {
+            if (names[i] == name) return i;
+        }
+        uint8_t slot = nextName;
+        nextName = (nextName + 1) % LCDMENU_TRACE_NAMES;
+        names[slot] = name;
+        // Bind the name to the slot before the event that uses it
+        frame.write(LCDMENU_TRACE_SYNC);
+        frame.write('D');
+        frame.write(slot);
+        uint8_t lengthAt = frame.length;
+        frame.write((uint8_t)0);
+        uint8_t start = frame.length;
+        frame.print(name);
+        if (lengthAt < frame.length) frame.data[lengthAt] = frame.length - start;
+        return slot;
+    }
+
+    void renderText(const Event& event) {
+        frame.print(F("#LOG# "));
+        frame.print(event.name);
+        if (event.type != NONE) frame.print('=');
+        switch (event.type) {
+            case INT:
+                frame.print(event.value.i);
+                break;
+            case UINT:
+                frame.print(event.value.u);
+                break;
+            case FLOAT:
+                frame.print(event.value.f);
+                break;
+            case CHAR:
+                frame.print(event.value.c);
+                break;
+            case TEXT:
+                frame.print(textOf(event));
+                break;
+            default:
+                break;
+        }
+        // Keep the line terminated even when it was cut
+        if (frame.truncated) frame.length--;
+        frame.write('\n');
+    }
+
+    void renderBinary(const Event& event) {
+        uint8_t slot = slotOf(event.name);
+        frame.write(LCDMENU_TRACE_SYNC);
+        frame.write('E');
+        frame.write(slot);
+        frame.write(event.type);
+        frame.writeLong(event.time);
+        switch (event.type) {
+            case INT:
+            case UINT:
+                frame.writeLong(event.value.u);
+                break;
+            case FLOAT: {
+                uint32_t bits;
+                memcpy(&bits, &event.value.f, sizeof(bits));
+                frame.writeLong(bits);
+                break;
+            }
+            case CHAR:
+                frame.write(event.value.c);
+                break;
+            case TEXT: {
+                const char* text = textOf(event);
+                uint8_t length = strlen(text) < LCDMENU_TRACE_TEXT_SIZE ? strlen(text) : LCDMENU_TRACE_TEXT_SIZE;
+                frame.write(length);
+                frame.write((const uint8_t*)text, length);
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    /**
+     * @brief Render the next frame to send.
+     * @return `false` if there is nothing left to send
+     */
+    bool next() {
+        frame.clear();
+        if (dropped > 0) {
+            if (binary) {
+                frame.write(LCDMENU_TRACE_SYNC);
+                frame.write('X');
+                frame.write((uint8_t)dropped);
+                frame.write((uint8_t)(dropped >> 8));
+            } else {
+                frame.print(F("#LOG# LcdMenuTrace::dropped="));
+                frame.print((unsigned long)dropped);
+                frame.write('\n');
+            }
+            dropped = 0;
+            return true;
+        }
+        if (count == 0) return false;
+        const Event& event = events[head];
+        if (binary) {
+            renderBinary(event);
+        } else {
+            renderText(event);
+        }
+        head = (head + 1) % LCDMENU_TRACE_CAPACITY;
+        count--;
+        return true;
+    }
+
+  public:
+    void record(const __FlashStringHelper* name) { push(name, NONE); }
+    void record(const __FlashStringHelper* name, bool value) { record(name, (unsigned long)value); }
+    void record(const __FlashStringHelper* name, char value) {
+        Event* event = push(name, CHAR);
+        if (event != nullptr) event->value.c = value;
+    }
+    void record(const __FlashStringHelper* name, signed char value) { record(name, (long)value); }
+    void record(const __FlashStringHelper* name, unsigned char value) { record(name, (unsigned long)value); }
+    void record(const __FlashStringHelper* name, short value) { record(name, (long)value); }
+    void record(const __FlashStringHelper* name, unsigned short value) { record(name, (unsigned long)value); }
+    void record(const __FlashStringHelper* name, int value) { record(name, (long)value); }
+    void record(const __FlashStringHelper* name, unsigned int value) { record(name, (unsigned long)value); }
+    void record(const __FlashStringHelper* name, long value) {
+        Event* event = push(name, INT);
+        if (event != nullptr) event->value.i = value;
+    }
+    void record(const __FlashStringHelper* name, unsigned long value) {
+        Event* event = push(name, UINT);
+        if (event != nullptr) event->value.u = value;
+    }
+    void record(const __FlashStringHelper* name, float value) {
+        Event* event = push(name, FLOAT);
+        if (event != nullptr) event->value.f = value;
+    }
+    void record(const __FlashStringHelper* name, double value) { record(name, (float)value); }
+    /**
+     * @brief Record a constant string, such as an item text.
+     * Only the pointer is kept, the string must outlive the event.
+     */
+    void record(const __FlashStringHelper* name, const char* value) { pushText(name, value, true); }
+    /**
+     * @brief Record a mutable string, such as an input value.
+     * The first `LCDMENU_TRACE_TEXT_SIZE - 1` characters are copied.
+     */
+    void record(const __FlashStringHelper* name, char* value) { pushText(name, value, false); }
+    /**
+     * @brief Record a text that may be in flash.
+     * Texts in RAM are kept by pointer, texts in flash are copied.
+     */
+    void record(const __FlashStringHelper* name, const MenuText& value) {
+        if (!value.inFlash) return pushText(name, value.text, true);
+        char text[LCDMENU_TRACE_TEXT_SIZE];
+        pushText(name, value.load(text, sizeof(text)), false);
+    }
+    void record(const __FlashStringHelper* name, const __FlashStringHelper* value) { record(name, MenuText(value)); }
+
+    /**
+     * @brief Send as much of the trace as `out` can take without blocking.
+     * A frame that does not fit is sent in parts by the next calls.
+     * Outputs that always report 0 from `availableForWrite` need `flush`.
+     * @return `true` when everything was sent
+     */
+    bool drain(Print& out) {
+        while (true) {
+            if (frame.isSent() && !next()) return true;
+            int room = out.availableForWrite();
+            if (room <= 0) return false;
+            uint8_t size = frame.length - frame.sent;
+            if ((unsigned int)room < size) size = room;
+            frame.sent += out.write(frame.data + frame.sent, size);
+        }
+    }
+    /**
+     * @brief Send the whole trace, waiting for the output.
+     */
+    void flush(Print& out) {
+        while (!frame.isSent() || next()) {
+            frame.sent += out.write(frame.data + frame.sent, frame.length - frame.sent);
+        }
+    }
+    /**
+     * @brief Switch between text and binary format.
+     * Names are sent again after switching to binary format.
+     */
+    void setBinary(bool binary) {
+        if (binary && !this->binary) {
+            memset(names, 0, sizeof(names));
+            nextName = 0;
+        }
+        this->binary = binary;
+    }
+    bool isBinary() const { return binary; }
+    /**
+     * @brief Use `clock` instead of `millis()` to stamp events, see `MenuRenderer::setClock`.
+     */
+    void setClock(Clock* clock) { this->clock = clock != NULL ? clock : &systemClock(); }
+    /**
+     * @brief Number of events waiting to be sent.
+     */
+    uint8_t size() const { return count; }
+    /**
+     * @brief Number of events dropped since the last drop report was sent.
+     */
+    uint16_t getDropped() const { return dropped; }
+};
+
+/**
+ * @brief The trace used by `LOG`.
+ */
+inline LcdMenuTrace& lcdMenuTrace() {
+    static LcdMenuTrace trace;
+    return trace;
+}
+
+#ifdef DEBUG
+/**
+ * @brief Send pending trace events, called regularly by the menu and the input adapters.
+ */
+#define TRACE_DRAIN() lcdMenuTrace().drain(LCDMENU_TRACE_OUTPUT)
+#else
+#define TRACE_DRAIN()  // No-op
+#endif
+
+#endif  // LCD_MENU_TRACE_H
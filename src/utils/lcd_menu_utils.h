@@ -2,6 +2,7 @@
 #define LCD_MENU_UTILS_H
 
 #include "lcd_menu_constants.h"
+#include "lcd_menu_trace.h"
 #include <Arduino.h>
 
 inline void substring(const char* str, uint8_t start, uint8_t size, char* substr) {
@@ -41,23 +42,19 @@ inline void remove(char* str, uint8_t index, uint8_t count) {
 
 #ifdef DEBUG
 #define LOG(...) log(__VA_ARGS__)
-inline void log(const __FlashStringHelper* command) {
-    String message(F("#LOG# "));
-    message += command;
-    message += '\n';
-    Serial.print(message);
-    Serial.flush();
-}
-
-template <typename T>
-inline void log(const __FlashStringHelper* command, T value) {
-    String message(F("#LOG# "));
-    message += command;
-    message += F("=");
-    message += String(value);
-    message += '\n';
-    Serial.print(message);
-    Serial.flush();
+/**
+ * @brief Record a debug event and send what the output can take without waiting.
+ * Sent as `#LOG# command` or `#LOG# command=value`, see `LcdMenuTrace`.
+ * Define `LCDMENU_TRACE_BLOCKING` to wait until the event is sent.
+ */
+template <typename... T>
+inline void log(const __FlashStringHelper* command, T... value) {
+    lcdMenuTrace().record(command, value...);
+#ifdef LCDMENU_TRACE_BLOCKING
+    lcdMenuTrace().flush(LCDMENU_TRACE_OUTPUT);
+#else
+    lcdMenuTrace().drain(LCDMENU_TRACE_OUTPUT);
+#endif
 }
 #else
 #define LOG(...)  // No-op
@@ -36,6 +36,7 @@
 #include <stdint.h>
 
 #include "printf.h"
+#include "LcdMenuConfig.h"
 
 // 'ntoa' conversion buffer size, this must be big enough to hold one converted
 // numeric number including padded zeros (dynamically created on stack)
@@ -52,7 +53,10 @@
 #endif
 
 // support for the floating point type (%f)
-// default: activated
+// default: activated, unless LCDMENU_FLOAT is off
+#if !LCDMENU_FLOAT && !defined(PRINTF_DISABLE_SUPPORT_FLOAT)
+#define PRINTF_DISABLE_SUPPORT_FLOAT
+#endif
 #ifndef PRINTF_DISABLE_SUPPORT_FLOAT
 #define PRINTF_SUPPORT_FLOAT
 #endif
@@ -529,6 +533,13 @@ static int _vsnprintf(out_fct_type out, char* buffer, const size_t maxlen, const
                 idx = _ftoa(out, buffer, idx, maxlen, va_arg(va, double), precision, width, flags);
                 format++;
                 break;
+#else
+            case 'f':
+            case 'F':
+                // Skip the argument so the ones after it stay in place
+                (void)va_arg(va, double);
+                format++;
+                break;
 #endif  // PRINTF_SUPPORT_FLOAT
             case 'c':
                 {
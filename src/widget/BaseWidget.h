@@ -1,8 +1,15 @@
 // Creator: @ShishkinDmitriy
 #pragma once
 
+#include "LcdMenuConfig.h"
+#include "WidgetNumber.h"
+#include "diagnostics/MemoryReport.h"
 #include "utils/custom_printf.h"
 
+#if !LCDMENU_WIDGETS
+#error "Widgets are disabled, see LCDMENU_WIDGETS in LcdMenuConfig.h"
+#endif
+
 class LcdMenu;
 
 /**
@@ -52,5 +59,24 @@ class BaseWidget {
     virtual void cancelEdit() {}
 
   public:
+    /**
+     * @brief Add the memory taken by this widget to the report.
+     * @param report the report to add to
+     */
+    virtual void report(MemoryReport& report) { report.add(MemoryReport::WIDGET, sizeof(*this)); }
+    /**
+     * @brief Read the value of this widget as a number.
+     * @param number receives the value
+     * @return `false` if the value is not a number
+     */
+    virtual bool readNumber(WidgetNumber& /*number*/) const { return false; }
+    /**
+     * @brief Set the value of this widget from a number.
+     * The value goes through `setValue`, so range widgets clamp it.
+     * @note You need to call `LcdMenu::refresh` after this method to see the changes.
+     * @return `false` if the value is not a number
+     */
+    virtual bool writeNumber(const WidgetNumber& /*number*/) { return false; }
+
     virtual ~BaseWidget() = default;
 };
\ No newline at end of file
@@ -2,6 +2,7 @@
 #pragma once
 
 #include "BaseWidget.h"
+#include "SharedValue.h"
 
 class LcdMenu;
 
@@ -50,6 +51,31 @@ struct Ref {
     operator T() const noexcept { return value; }  // Cast to T
 };
 
+/**
+ * @brief Like `Ref<T>`, for a value shared with a task or an ISR, see `SharedValue`.
+ * Every read loads a consistent copy, every write stores a new value.
+ */
+template <typename T>
+struct SharedRef {
+    SharedValue<T>& value;
+    SharedRef(SharedValue<T>& value) : value(value) {}
+    bool operator==(T const& other) const noexcept { return value.load() == other; }
+    bool operator!=(T const& other) const noexcept { return value.load() != other; }
+    bool operator>(T const& other) const noexcept { return value.load() > other; }
+    bool operator<(T const& other) const noexcept { return value.load() < other; }
+    bool operator>=(T const& other) const noexcept { return value.load() >= other; }
+    bool operator<=(T const& other) const noexcept { return value.load() <= other; }
+    SharedRef<T>& operator=(T other) noexcept {
+        value.store(other);
+        return *this;
+    }
+    SharedRef<T>& operator=(const SharedRef<T>& other) noexcept {
+        value.store(other.value.load());
+        return *this;
+    }
+    operator T() const noexcept { return value.load(); }  // Cast to T
+};
+
 /**
  * @class BaseWidgetValue
  * @brief Base class for widget holding some value.
@@ -61,13 +87,13 @@ class BaseWidgetValue : public BaseWidget {
 
   protected:
     T value;
-    const char* format = nullptr;
+    MenuText format;
     void (*callback)(const T&) = nullptr;
 
   public:
     BaseWidgetValue(
         const T& value,
-        const char* format,
+        MenuText format,
         const uint8_t cursorOffset = 0,
         void (*callback)(const T&) = nullptr)
         : BaseWidget(cursorOffset), value(value), format(format), callback(callback) {}
@@ -88,7 +114,22 @@ class BaseWidgetValue : public BaseWidget {
         }
     }
 
+    bool readNumber(WidgetNumber& number) const override {
+        return WidgetNumberTraits<T>::read(value, number);
+    }
+
+    bool writeNumber(const WidgetNumber& number) override {
+        return WidgetNumberTraits<T>::write(number, *this);
+    }
+
   protected:
+    /**
+     * @brief Add a widget of `size` bytes and its format to the report.
+     */
+    void reportWidget(MemoryReport& report, size_t size) const {
+        report.add(MemoryReport::WIDGET, size);
+        report.addText(format);
+    }
     /**
      * @brief Draw the widget into specified buffer.
      *
@@ -96,8 +137,21 @@ class BaseWidgetValue : public BaseWidget {
      * @param start the index where to start drawing in the buffer
      */
     uint8_t draw(char* buffer, const uint8_t start) override {
+        return drawFormatted(buffer, start, value);
+    }
+    /**
+     * @brief Draw `argument` with the widget's format into specified buffer.
+     * A format in flash is copied to the stack for the time it is used.
+     *
+     * @param buffer the buffer where widget will be drawn
+     * @param start the index where to start drawing in the buffer
+     * @param argument the argument of the format
+     */
+    template <typename A>
+    uint8_t drawFormatted(char* buffer, const uint8_t start, A argument) const {
         if (start >= ITEM_DRAW_BUFFER_SIZE) return 0;
-        return snprintf(buffer + start, ITEM_DRAW_BUFFER_SIZE - start, format, value);
+        char text[ITEM_DRAW_BUFFER_SIZE];
+        return snprintf(buffer + start, ITEM_DRAW_BUFFER_SIZE - start, format.load(text, sizeof(text)), argument);
     }
 
     /**
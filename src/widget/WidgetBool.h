@@ -14,16 +14,16 @@ template <typename V = bool>
 class WidgetBool : public BaseWidgetValue<V> {
 
   protected:
-    const char* textOn;
-    const char* textOff;
+    MenuText textOn;
+    MenuText textOff;
     bool originalValue;
 
   public:
     WidgetBool(
         V value,
-        const char* textOn,
-        const char* textOff,
-        const char* format,
+        MenuText textOn,
+        MenuText textOff,
+        MenuText format,
         const uint8_t cursorOffset,
         void (*callback)(const V&) = nullptr)
         : BaseWidgetValue<V>(value, format, cursorOffset, callback),
@@ -31,10 +31,16 @@ class WidgetBool : public BaseWidgetValue<V> {
           textOff(textOff),
           originalValue(static_cast<bool>(value)) {}
 
+    void report(MemoryReport& report) override {
+        this->reportWidget(report, sizeof(*this));
+        report.addText(textOn);
+        report.addText(textOff);
+    }
+
   protected:
     uint8_t draw(char* buffer, const uint8_t start) override {
-        if (start >= ITEM_DRAW_BUFFER_SIZE) return 0;
-        return snprintf(buffer + start, ITEM_DRAW_BUFFER_SIZE - start, this->format, static_cast<bool>(this->value) ? textOn : textOff);
+        char text[ITEM_DRAW_BUFFER_SIZE];
+        return this->drawFormatted(buffer, start, (static_cast<bool>(this->value) ? textOn : textOff).load(text, sizeof(text)));
     }
     /**
      * @brief Process command.
@@ -72,9 +78,9 @@ class WidgetBool : public BaseWidgetValue<V> {
  */
 inline BaseWidgetValue<bool>* WIDGET_BOOL(
     const bool value = false,
-    const char* textOn = "ON",
-    const char* textOff = "OFF",
-    const char* format = "%s",
+    MenuText textOn = "ON",
+    MenuText textOff = "OFF",
+    MenuText format = "%s",
     const uint8_t cursorOffset = 0,
     void (*callback)(const bool&) = nullptr) {
     return new WidgetBool<bool>(value, textOn, textOff, format, cursorOffset, callback);
@@ -93,9 +99,9 @@ inline BaseWidgetValue<bool>* WIDGET_BOOL(
  */
 inline BaseWidgetValue<Ref<bool>>* WIDGET_BOOL_REF(
     bool& value,
-    const char* textOn = "ON",
-    const char* textOff = "OFF",
-    const char* format = "%s",
+    MenuText textOn = "ON",
+    MenuText textOff = "OFF",
+    MenuText format = "%s",
     const uint8_t cursorOffset = 0,
     void (*callback)(const Ref<bool>&) = nullptr) {
     return new WidgetBool<Ref<bool>>(Ref<bool>(value), textOn, textOff, format, cursorOffset, callback);
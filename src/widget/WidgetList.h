@@ -28,7 +28,7 @@ class WidgetList : public BaseWidgetValue<V> {
     WidgetList(
         const std::vector<T>& values,
         const V activePosition,
-        const char* format,
+        MenuText format,
         const uint8_t cursorOffset,
         const bool cycle,
         void (*callback)(const V&))
@@ -37,6 +37,23 @@ class WidgetList : public BaseWidgetValue<V> {
           values(values),
           originalValue(static_cast<V>(activePosition)) {}
 
+    /**
+     * @brief Add this widget to the report.
+     * The list of values is not included, it is owned by the sketch.
+     */
+    void report(MemoryReport& report) override { this->reportWidget(report, sizeof(*this)); }
+
+    /**
+     * @brief Sets the active position, ignoring positions outside the list.
+     * @param newValue The position to set.
+     * @note You need to call `LcdMenu::refresh` after this method to see the changes.
+     */
+    void setValue(const V& newValue) override {
+        if (static_cast<uint8_t>(newValue) < values.size()) {
+            BaseWidgetValue<V>::setValue(newValue);
+        }
+    }
+
   protected:
     /**
      * @brief Process command.
@@ -72,8 +89,7 @@ class WidgetList : public BaseWidgetValue<V> {
      * @param start the index where to start drawing in the buffer
      */
     uint8_t draw(char* buffer, const uint8_t start) override {
-        if (start >= ITEM_DRAW_BUFFER_SIZE) return 0;
-        return snprintf(buffer + start, ITEM_DRAW_BUFFER_SIZE - start, this->format, values[(uint8_t)this->value]);
+        return this->drawFormatted(buffer, start, values[(uint8_t)this->value]);
     }
     bool nextValue() {
         if (static_cast<int>(this->value) + 1 < static_cast<int>(values.size())) {
@@ -118,7 +134,7 @@ template <typename T>
 inline BaseWidgetValue<uint8_t>* WIDGET_LIST(
     const std::vector<T>& values,
     const uint8_t activePosition = 0,
-    const char* format = "%s",
+    MenuText format = "%s",
     const uint8_t cursorOffset = 0,
     const bool cycle = false,
     void (*callback)(const uint8_t&) = nullptr) {
@@ -141,7 +157,7 @@ template <typename T>
 inline BaseWidgetValue<Ref<uint8_t>>* WIDGET_LIST_REF(
     const std::vector<T>& values,
     uint8_t& activePosition,
-    const char* format = "%s",
+    MenuText format = "%s",
     const uint8_t cursorOffset = 0,
     const bool cycle = false,
     void (*callback)(const Ref<uint8_t>&) = nullptr) {
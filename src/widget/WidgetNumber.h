@@ -0,0 +1,144 @@
+#pragma once
+
+#include <Arduino.h>
+
+template <typename T>
+struct Ref;
+template <typename T>
+struct SharedRef;
+template <typename T>
+class SharedValue;
+
+/**
+ * @struct WidgetNumber
+ * @brief A widget value as a number, used to read and write values without
+ *        knowing the widget's type, see `BaseWidget::readNumber`.
+ *
+ * Integral types, `bool` and list indices are `INTEGER`, `float` and `double`
+ * are `REAL`. Writing converts between the two.
+ */
+struct WidgetNumber {
+    enum Type : uint8_t {
+        INTEGER = 'i',
+        REAL = 'f'
+    };
+
+    Type type;
+    union {
+        int32_t integer;
+        float real;
+    };
+
+    WidgetNumber() : type(INTEGER), integer(0) {}
+
+    static WidgetNumber fromInteger(int32_t value) {
+        WidgetNumber n;
+        n.integer = value;
+        return n;
+    }
+
+    static WidgetNumber fromReal(float value) {
+        WidgetNumber n;
+        n.type = REAL;
+        n.real = value;
+        return n;
+    }
+
+    int32_t toInteger() const { return type == INTEGER ? integer : static_cast<int32_t>(real < 0 ? real - 0.5f : real + 0.5f); }
+    float toReal() const { return type == REAL ? real : static_cast<float>(integer); }
+};
+
+/**
+ * @brief Converts values of type `T` to and from `WidgetNumber`.
+ * `write` passes the converted value to the widget's `setValue`.
+ * Types that are not numbers cannot be converted.
+ */
+template <typename T>
+struct WidgetNumberTraits {
+    static bool read(const T&, WidgetNumber&) { return false; }
+    template <typename W>
+    static bool write(const WidgetNumber&, W&) { return false; }
+};
+
+template <typename T>
+struct WidgetNumberTraits<Ref<T>> : WidgetNumberTraits<T> {};
+
+template <typename T>
+struct WidgetNumberTraits<SharedRef<T>> {
+    static bool read(const SharedRef<T>& value, WidgetNumber& number) {
+        return WidgetNumberTraits<T>::read(static_cast<T>(value), number);
+    }
+    // `setValue` takes a `SharedRef`, pass it one to a temporary copy
+    template <typename W>
+    struct Setter {
+        W& widget;
+        void setValue(const T& value) {
+            SharedValue<T> copy(value);
+            widget.setValue(SharedRef<T>(copy));
+        }
+    };
+    template <typename W>
+    static bool write(const WidgetNumber& number, W& widget) {
+        Setter<W> setter = {widget};
+        return WidgetNumberTraits<T>::write(number, setter);
+    }
+};
+
+#define WIDGET_NUMBER_INTEGER(T)                                                                   \
+    template <>                                                                                    \
+    struct WidgetNumberTraits<T> {                                                                 \
+        static bool read(const T& value, WidgetNumber& number) {                                   \
+            number = WidgetNumber::fromInteger(static_cast<int32_t>(value));                       \
+            return true;                                                                           \
+        }                                                                                          \
+        template <typename W>                                                                      \
+        static bool write(const WidgetNumber& number, W& widget) {                                 \
+            T value = static_cast<T>(number.toInteger());                                          \
+            widget.setValue(value);                                                                \
+            return true;                                                                           \
+        }                                                                                          \
+    };
+
+#define WIDGET_NUMBER_REAL(T)                                                                      \
+    template <>                                                                                    \
+    struct WidgetNumberTraits<T> {                                                                 \
+        static bool read(const T& value, WidgetNumber& number) {                                   \
+            number = WidgetNumber::fromReal(static_cast<float>(value));                            \
+            return true;                                                                           \
+        }                                                                                          \
+        template <typename W>                                                                      \
+        static bool write(const WidgetNumber& number, W& widget) {                                 \
+            T value = static_cast<T>(number.toReal());                                             \
+            widget.setValue(value);                                                                \
+            return true;                                                                           \
+        }                                                                                          \
+    };
+
+WIDGET_NUMBER_INTEGER(char)
+WIDGET_NUMBER_INTEGER(signed char)
+WIDGET_NUMBER_INTEGER(unsigned char)
+WIDGET_NUMBER_INTEGER(short)
+WIDGET_NUMBER_INTEGER(unsigned short)
+WIDGET_NUMBER_INTEGER(int)
+WIDGET_NUMBER_INTEGER(unsigned int)
+WIDGET_NUMBER_INTEGER(long)
+WIDGET_NUMBER_INTEGER(unsigned long)
+WIDGET_NUMBER_REAL(float)
+WIDGET_NUMBER_REAL(double)
+
+#undef WIDGET_NUMBER_INTEGER
+#undef WIDGET_NUMBER_REAL
+
+template <>
+struct WidgetNumberTraits<bool> {
+    static bool read(const bool& value, WidgetNumber& number) {
+        number = WidgetNumber::fromInteger(value ? 1 : 0);
+        return true;
+    }
+    template <typename W>
+    static bool write(const WidgetNumber& number, W& widget) {
+        bool value = number.toInteger() != 0;
+        widget.setValue(value);
+        return true;
+    }
+};
@@ -26,7 +26,7 @@ class WidgetRange : public BaseWidgetValue<V> {
         const T step,
         const T min,
         const T max,
-        const char* format,
+        MenuText format,
         const uint8_t cursorOffset = 0,
         const bool cycle = false,
         void (*callback)(const V&) = nullptr)
@@ -37,6 +37,8 @@ class WidgetRange : public BaseWidgetValue<V> {
           cycle(cycle),
           originalValue(static_cast<T>(value)) {}
 
+    void report(MemoryReport& report) override { this->reportWidget(report, sizeof(*this)); }
+
     /**
      * @brief Sets the value.
      * @param newValue The value to set.
@@ -104,8 +106,7 @@ class WidgetRange : public BaseWidgetValue<V> {
         return false;
     }
     uint8_t draw(char* buffer, const uint8_t start) override {
-        if (start >= ITEM_DRAW_BUFFER_SIZE) return 0;
-        return snprintf(buffer + start, ITEM_DRAW_BUFFER_SIZE - start, this->format, static_cast<T>(this->value));
+        return this->drawFormatted(buffer, start, static_cast<T>(this->value));
     }
 
     void startEdit() override { originalValue = static_cast<T>(this->value); }
@@ -132,7 +133,7 @@ inline BaseWidgetValue<T>* WIDGET_RANGE(
     const T step,
     const T min,
     const T max,
-    const char* format,
+    MenuText format,
     const uint8_t cursorOffset = 0,
     const bool cycle = false,
     void (*callback)(const T&) = nullptr) {
@@ -159,9 +160,36 @@ inline BaseWidgetValue<Ref<T>>* WIDGET_RANGE_REF(
     const T step,
     const T min,
     const T max,
-    const char* format,
+    MenuText format,
     const uint8_t cursorOffset = 0,
     const bool cycle = false,
     void (*callback)(const Ref<T>&) = nullptr) {
     return new WidgetRange<T, Ref<T>>(Ref<T>(value), step, min, max, format, cursorOffset, cycle, callback);
 }
+
+/**
+ * @brief Function to create a new WidgetRange<T> instance on a value shared with a task or an ISR.
+ * The widget reads consistent copies of the value, see `SharedValue`.
+ * @tparam T The type of the value.
+ *
+ * @param value The shared value of this widget.
+ * @param step The step value for incrementing/decrementing (use negative value to invert the range).
+ * @param min The minimum value of the range.
+ * @param max The maximum value of the range.
+ * @param format The format string for displaying the value.
+ * @param cursorOffset The offset for the cursor (default is 0).
+ * @param cycle Whether the value should cycle when out of range (default is false).
+ * @param callback The callback function to call when the value changes (default is nullptr), parameter of callback will be `SharedRef<T>`
+ */
+template <typename T>
+inline BaseWidgetValue<SharedRef<T>>* WIDGET_RANGE_REF(
+    SharedValue<T>& value,
+    const T step,
+    const T min,
+    const T max,
+    MenuText format,
+    const uint8_t cursorOffset = 0,
+    const bool cycle = false,
+    void (*callback)(const SharedRef<T>&) = nullptr) {
+    return new WidgetRange<T, SharedRef<T>>(SharedRef<T>(value), step, min, max, format, cursorOffset, cycle, callback);
+}
@@ -0,0 +1,99 @@
+#include <ArduinoUnitTests.h>
+#include <ItemInput.h>
+#include <LcdMenu.h>
+#include <MenuScreen.h>
+#include <display/ShadowDisplay.h>
+
+#include "support/MenuFixture.h"
+
+#define LCD_ROWS 2
+#define LCD_COLS 16
+
+// A glyph animated by uploading its frames to one slot.
+
+const uint8_t spinner[4][8] = {
+    {0x00, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x01, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00}};
+
+char name[10] = "Pump";
+ItemInput nameInput("Name", name, NULL);
+MenuItem sync("Sync \x02");
+MenuItem save("Save \x02");
+MenuScreen* screen = new MenuScreen({&sync, &save, &nameInput});
+
+struct Fixture : MenuFixture<LCD_COLS, LCD_ROWS> {
+    Fixture() {
+        start(screen);
+        renderer.setAnimation(2, spinner, 4, 200);
+    }
+};
+
+unittest(one_upload_per_frame_for_every_cell) {
+    Fixture f;
+    assertEqual(0, memcmp(f.display.glyphs[2], spinner[0], 8));
+
+    uint16_t before = f.display.busBytes();
+    f.clock.advance(199);
+    f.menu.poll(0);
+    assertEqual(before, f.display.busBytes());
+
+    f.clock.advance(1);
+    f.menu.poll(0);
+    // Both rows show the glyph, the frame is still a single upload
+    assertEqual(before + 9, f.display.busBytes());
+    assertEqual(0, memcmp(f.display.glyphs[2], spinner[1], 8));
+
+    for (uint8_t i = 0; i < 3; i++) {
+        f.clock.advance(200);
+        f.menu.poll(0);
+    }
+    assertEqual(0, memcmp(f.display.glyphs[2], spinner[0], 8));
+}
+
+unittest(no_frames_while_the_display_is_off) {
+    Fixture f;
+    f.renderer.setPowerTimeouts(0, 1000);
+    f.clock.advance(1000);
+    f.renderer.updateTimer();
+    assertEqual(MenuRenderer::OFF, f.renderer.getPowerState());
+
+    uint16_t uploads = f.display.uploads;
+    f.clock.advance(1000);
+    f.menu.poll(0);
+    assertEqual(uploads, f.display.uploads);
+
+    f.renderer.stopAnimation();
+    f.renderer.restartTimer();
+    f.clock.advance(1000);
+    f.menu.poll(0);
+    assertEqual(uploads, f.display.uploads);
+}
+
+unittest(edit_cursor_is_moved_back_after_a_frame) {
+    Fixture f;
+    f.menu.process(DOWN);
+    f.menu.process(DOWN);
+    f.menu.process(ENTER);
+    assertTrue(f.menu.isEditing());
+
+    uint16_t moves = f.display.cursorMoves;
+    f.clock.advance(200);
+    f.menu.poll(0);
+    assertEqual(moves + 1, f.display.cursorMoves);
+    assertFalse(f.display.inGlyphMemory);
+    f.menu.process(BACK);
+}
+
+unittest(shadow_display_moves_back_after_an_upload) {
+    GridDisplay<LCD_COLS, LCD_ROWS> display;
+    ShadowDisplay shadow(&display, LCD_COLS, LCD_ROWS, 0);
+    shadow.setCursor(0, 0);
+    shadow.draw('a');
+    shadow.createChar(2, const_cast<uint8_t*>(spinner[1]));
+    shadow.draw('b');
+    assertEqual(0, display.misplaced);
+}
+
+unittest_main()
@@ -0,0 +1,302 @@
+#include <ArduinoUnitTests.h>
+#include <ItemInputCharset.h>
+#include <ItemSubMenu.h>
+#include <ItemWidget.h>
+#include <LcdMenu.h>
+#include <MenuScreen.h>
+#include <renderer/CharacterDisplayRenderer.h>
+#include <widget/WidgetBool.h>
+#include <widget/WidgetList.h>
+#include <widget/WidgetRange.h>
+
+#include "support/GridDisplay.h"
+
+#define LCD_ROWS 2
+#define LCD_COLS 16
+
+// Replays the navigation scenarios of the examples against a display that
+// counts what would be sent over the bus, and fails when a single step costs
+// more than its budget.
+
+struct Budget {
+    uint16_t setCursorCalls;
+    uint16_t dataBytes;
+    uint16_t clearCalls;
+};
+
+struct Step {
+    unsigned char command;
+    Budget budget;
+};
+
+// Nothing to redraw
+const Budget IDLE = {0, 0, 0};
+// Blinking cursor moved within the row
+const Budget CURSOR = {1, 0, 0};
+// One character redrawn in place, cursor restored
+const Budget GLYPH = {2, 1, 0};
+// One row redrawn: row start, scroll indicator, focus cursor
+const Budget ROW = {3, LCD_COLS, 0};
+// One row redrawn, then the edit cursor moved
+const Budget ROW_EDIT = {4, LCD_COLS, 0};
+// Multi-widget row in edit mode: drawn up to the active widget, then in full
+const Budget WIDGET_ROW = {7, 2 * LCD_COLS, 0};
+// Every row redrawn
+const Budget SCREEN = {5, LCD_ROWS * LCD_COLS, 0};
+// Every row redrawn after switching screens, without clearing the display
+const Budget SCREEN_SWITCH = {5, LCD_ROWS * LCD_COLS, 0};
+
+GridDisplay<LCD_COLS, LCD_ROWS> display;
+CharacterDisplayRenderer renderer(&display, LCD_COLS, LCD_ROWS);
+LcdMenu menu(renderer);
+
+Budget cost(unsigned char command) {
+    GridDisplay<LCD_COLS, LCD_ROWS> before = display;
+    menu.process(command);
+    return {
+        static_cast<uint16_t>(display.cursorMoves - before.cursorMoves),
+        static_cast<uint16_t>(display.writes - before.writes),
+        static_cast<uint16_t>(display.clears - before.clears)};
+}
+
+Budget switchCost(MenuScreen* screen) {
+    GridDisplay<LCD_COLS, LCD_ROWS> before = display;
+    menu.setScreen(screen);
+    return {
+        static_cast<uint16_t>(display.cursorMoves - before.cursorMoves),
+        static_cast<uint16_t>(display.writes - before.writes),
+        static_cast<uint16_t>(display.clears - before.clears)};
+}
+
+#define assertWithinBudget(actual, expected)                                \
+    do {                                                                    \
+        Budget _actual = (actual);                                          \
+        assertLessOrEqual(_actual.setCursorCalls, expected.setCursorCalls); \
+        assertLessOrEqual(_actual.dataBytes, expected.dataBytes);           \
+        assertLessOrEqual(_actual.clearCalls, expected.clearCalls);         \
+    } while (0)
+
+#define assertStepsWithinBudget(steps)                               \
+    for (size_t i = 0; i < sizeof(steps) / sizeof(steps[0]); i++) {  \
+        assertWithinBudget(cost(steps[i].command), steps[i].budget); \
+    }
+
+// Basic
+// clang-format off
+MENU_SCREEN(basicScreen, basicItems,
+    ITEM_BASIC("Start service"),
+    ITEM_BASIC("Connect to WiFi"),
+    ITEM_BASIC("Settings"),
+    ITEM_BASIC("Blink SOS"),
+    ITEM_BASIC("Blink random"));
+// clang-format on
+
+const Step basicSteps[] = {
+    {DOWN, SCREEN},
+    {DOWN, SCREEN},
+    {DOWN, SCREEN},
+    {DOWN, SCREEN},
+    {DOWN, IDLE},
+    {UP, SCREEN},
+    {UP, SCREEN},
+    {UP, SCREEN},
+    {UP, SCREEN},
+    {UP, IDLE},
+};
+
+// SubMenu
+extern MenuScreen* settingsScreen;
+extern MenuScreen* settings2Screen;
+
+// clang-format off
+MENU_SCREEN(subMenuScreen, subMenuItems,
+    ITEM_SUBMENU("Settings", settingsScreen),
+    ITEM_BASIC("Start service"),
+    ITEM_BASIC("Connect to WiFi"),
+    ITEM_BASIC("Blink SOS"),
+    ITEM_BASIC("Blink random"),
+    ITEM_SUBMENU("Settings 2", settings2Screen));
+
+MENU_SCREEN(settingsScreen, settingsItems,
+    ITEM_BASIC("Backlight"),
+    ITEM_BASIC("Contrast"),
+    ITEM_BASIC("Contrast1"),
+    ITEM_BASIC("Contrast2"),
+    ITEM_BASIC("Contrast3"),
+    ITEM_BASIC("Contrast4"),
+    ITEM_BASIC("Contrast5"),
+    ITEM_BASIC("Contrast6"),
+    ITEM_BASIC("Contrast7"),
+    ITEM_SUBMENU("Settings2", settings2Screen));
+
+MENU_SCREEN(settings2Screen, settings2Items,
+    ITEM_BASIC("Backlight"),
+    ITEM_BASIC("Contrast"));
+// clang-format on
+
+const Step subMenuSteps[] = {
+    {ENTER, SCREEN_SWITCH},
+    {DOWN, SCREEN},
+    {DOWN, SCREEN},
+    {DOWN, SCREEN},
+    {DOWN, SCREEN},
+    {DOWN, SCREEN},
+    {DOWN, SCREEN},
+    {DOWN, SCREEN},
+    {DOWN, SCREEN},
+    {DOWN, SCREEN},
+    {ENTER, SCREEN_SWITCH},
+    {DOWN, SCREEN},
+    {BACK, SCREEN_SWITCH},
+    {BACK, SCREEN_SWITCH},
+    {DOWN, SCREEN},
+};
+
+// Widgets
+std::vector<const char*> options = {"Buy", "Sell"};
+
+// clang-format off
+MENU_SCREEN(widgetsScreen, widgetsItems,
+    ITEM_WIDGET(
+        "Auto",
+        [](const uint8_t option, bool isAuto) {},
+        WIDGET_LIST(options, 0, "%s", 0, true),
+        WIDGET_BOOL(false, "Yes", "No", ",%s")),
+    ITEM_WIDGET(
+        "Price",
+        [](int price) {},
+        WIDGET_RANGE(10, 5, 0, 1000, "%.1d\003", 1)),
+    ITEM_WIDGET(
+        "Quantity",
+        [](float quantity, int tolerance) {},
+        WIDGET_RANGE(1.0f, 0.1f, 0.1f, 100.0f, "%.1f", 0),
+        WIDGET_RANGE(10, 1, 0, 100, "\002%d%%", 1)));
+// clang-format on
+
+const Step widgetsSteps[] = {
+    {ENTER, WIDGET_ROW},
+    {UP, WIDGET_ROW},
+    {UP, WIDGET_ROW},
+    {DOWN, WIDGET_ROW},
+    {DOWN, WIDGET_ROW},
+    {RIGHT, WIDGET_ROW},
+    {UP, WIDGET_ROW},
+    {UP, WIDGET_ROW},
+    {ENTER, ROW},
+    {DOWN, SCREEN},
+    {ENTER, WIDGET_ROW},
+    {UP, WIDGET_ROW},
+    {UP, WIDGET_ROW},
+    {DOWN, WIDGET_ROW},
+    {ENTER, ROW},
+    {DOWN, SCREEN},
+    {ENTER, WIDGET_ROW},
+    {UP, WIDGET_ROW},
+    {UP, WIDGET_ROW},
+    {RIGHT, WIDGET_ROW},
+    {UP, WIDGET_ROW},
+    {DOWN, WIDGET_ROW},
+    {LEFT, WIDGET_ROW},
+    {BACK, ROW},
+};
+
+// ViewShifting
+// clang-format off
+MENU_SCREEN(viewShiftScreen, viewShiftItems,
+    ITEM_BASIC("I'm short"),
+    ITEM_BASIC("I'm a very long item that doesn't fit on the screen"),
+    ITEM_BASIC("I'm another very long item that doesn't fit on the screen"),
+    ITEM_BASIC("I'm quite long too"));
+// clang-format on
+
+const Step viewShiftSteps[] = {
+    {RIGHT, IDLE},
+    {RIGHT, IDLE},
+    {LEFT, IDLE},
+    {LEFT, IDLE},
+    {DOWN, SCREEN},
+    {RIGHT, SCREEN},
+    {RIGHT, SCREEN},
+    {RIGHT, SCREEN},
+    {RIGHT, SCREEN},
+    {RIGHT, SCREEN},
+    {DOWN, SCREEN},
+    {RIGHT, SCREEN},
+    {RIGHT, SCREEN},
+    {RIGHT, SCREEN},
+    {RIGHT, SCREEN},
+    {DOWN, SCREEN},
+    {RIGHT, SCREEN},
+    {RIGHT, SCREEN},
+    {RIGHT, SCREEN},
+    {RIGHT, SCREEN},
+    {RIGHT, SCREEN},
+    {RIGHT, IDLE},
+    {RIGHT, IDLE},
+    {LEFT, SCREEN},
+    {LEFT, SCREEN},
+    {LEFT, SCREEN},
+    {LEFT, SCREEN},
+    {LEFT, SCREEN},
+    {LEFT, IDLE},
+};
+
+// CharsetInput
+char charsetValue[] = "0123456";
+
+// clang-format off
+MENU_SCREEN(charsetScreen, charsetItems,
+    ITEM_INPUT_CHARSET("Con", charsetValue, "0123456789", [](char* value) {}),
+    ITEM_BASIC("Connect to WiFi"),
+    ITEM_BASIC("Blink SOS"),
+    ITEM_BASIC("Blink random"));
+// clang-format on
+
+const Step charsetSteps[] = {
+    {ENTER, ROW},
+    {UP, GLYPH},
+    {UP, GLYPH},
+    {DOWN, GLYPH},
+    {DOWN, GLYPH},
+    {ENTER, GLYPH},
+    {LEFT, CURSOR},
+    {LEFT, CURSOR},
+    {DOWN, GLYPH},
+    {UP, GLYPH},
+    {UP, GLYPH},
+    {ENTER, GLYPH},
+    {UP, GLYPH},
+    {LEFT, GLYPH},
+    {BACKSPACE, ROW_EDIT},
+    {LEFT, CURSOR},
+    {BACKSPACE, ROW_EDIT},
+    {BACK, ROW},
+};
+
+unittest(basic_navigation_stays_within_bus_budget) {
+    renderer.begin();
+    assertWithinBudget(switchCost(basicScreen), SCREEN_SWITCH);
+    assertStepsWithinBudget(basicSteps);
+}
+
+unittest(sub_menu_navigation_stays_within_bus_budget) {
+    assertWithinBudget(switchCost(subMenuScreen), SCREEN_SWITCH);
+    assertStepsWithinBudget(subMenuSteps);
+}
+
+unittest(widget_editing_stays_within_bus_budget) {
+    assertWithinBudget(switchCost(widgetsScreen), SCREEN_SWITCH);
+    assertStepsWithinBudget(widgetsSteps);
+}
+
+unittest(view_shifting_stays_within_bus_budget) {
+    assertWithinBudget(switchCost(viewShiftScreen), SCREEN_SWITCH);
+    assertStepsWithinBudget(viewShiftSteps);
+}
+
+unittest(charset_input_stays_within_bus_budget) {
+    assertWithinBudget(switchCost(charsetScreen), SCREEN_SWITCH);
+    assertStepsWithinBudget(charsetSteps);
+}
+
+unittest_main()
@@ -0,0 +1,132 @@
+#include <ArduinoUnitTests.h>
+#include <LcdMenu.h>
+#include <MenuScreen.h>
+#include <input/KeyboardAdapter.h>
+#include <input/RepeatState.h>
+#include <limits.h>
+#include <renderer/CharacterDisplayRenderer.h>
+
+#include "support/GridDisplay.h"
+
+#define LCD_ROWS 2
+#define LCD_COLS 16
+
+// Fast-forwards time dependent behavior with a simulated clock, including
+// the rollover of millis() after 49.7 days.
+
+// The last value before the clock wraps, `unsigned long` is 64-bit on the
+// host running the tests and 32-bit on the boards
+#define ROLLOVER ULONG_MAX
+
+class RecordingItem : public MenuItem {
+  public:
+    uint16_t draws = 0;
+    unsigned char lastCommand = 0;
+    RecordingItem(const char* text) : MenuItem(text) { polling = true; }
+    void draw(MenuRenderer*) override { draws++; }
+    bool process(LcdMenu*, const unsigned char command) override {
+        lastCommand = command;
+        return true;
+    }
+};
+
+class ByteStream : public Stream {
+  public:
+    int next = -1;
+    int available() override { return next >= 0; }
+    int read() override {
+        int c = next;
+        next = -1;
+        return c;
+    }
+    int peek() override { return next; }
+    size_t write(uint8_t) override { return 1; }
+};
+
+RecordingItem item("Polled");
+MenuScreen* screen = new MenuScreen({&item});
+
+unittest(display_timeout_survives_rollover) {
+    SimulatedClock clock(ROLLOVER - DISPLAY_TIMEOUT / 2);
+    GridDisplay<LCD_COLS, LCD_ROWS> display;
+    CharacterDisplayRenderer renderer(&display, LCD_COLS, LCD_ROWS);
+    renderer.setClock(&clock);
+    renderer.begin();
+
+    clock.advance(DISPLAY_TIMEOUT - 1);
+    renderer.updateTimer();
+    assertEqual(0, display.hideCalls);
+
+    clock.advance(1);
+    renderer.updateTimer();
+    assertEqual(1, display.hideCalls);
+}
+
+unittest(polling_fast_forwards_hours_across_rollover) {
+    SimulatedClock clock(ROLLOVER - 30UL * 60 * 1000);
+    GridDisplay<LCD_COLS, LCD_ROWS> display;
+    CharacterDisplayRenderer renderer(&display, LCD_COLS, LCD_ROWS);
+    renderer.setClock(&clock);
+    LcdMenu menu(renderer);
+    menu.setScreen(screen);
+    item.draws = 0;
+
+    // Three hours in steps of 50ms, polling once a second after setScreen drew the item
+    for (unsigned long t = 0; t < 3UL * 60 * 60 * 1000; t += 50) {
+        clock.advance(50);
+        menu.poll(1000);
+    }
+
+    assertEqual(3 * 60 * 60, item.draws);
+}
+
+unittest(repeat_state_repeats_across_rollover) {
+    RepeatState repeat(500, 100);
+    // The second repeat lands exactly on 0
+    unsigned long start = ROLLOVER - 599;
+    repeat.start(start);
+
+    assertFalse(repeat.shouldRepeat(start + 499));
+    assertTrue(repeat.shouldRepeat(start + 500));
+    assertFalse(repeat.shouldRepeat(start + 550));
+    assertTrue(repeat.shouldRepeat(start + 600));
+    assertFalse(repeat.shouldRepeat(start + 650));
+    assertTrue(repeat.shouldRepeat(start + 700));
+}
+
+unittest(keyboard_idle_escape_waits_across_rollover) {
+    SimulatedClock clock(ROLLOVER - 50);
+    GridDisplay<LCD_COLS, LCD_ROWS> display;
+    CharacterDisplayRenderer renderer(&display, LCD_COLS, LCD_ROWS);
+    renderer.setClock(&clock);
+    LcdMenu menu(renderer);
+    menu.setScreen(screen);
+    ByteStream stream;
+    KeyboardAdapter keyboard(&menu, &stream);
+    item.lastCommand = 0;
+
+    stream.next = ESC;
+    keyboard.observe();
+    clock.advance(10);
+    keyboard.observe();
+    assertEqual(0, item.lastCommand);
+
+    clock.advance(THRESHOLD);
+    keyboard.observe();
+    assertEqual(BACK, item.lastCommand);
+}
+
+unittest(null_clock_falls_back_to_millis) {
+    SimulatedClock clock;
+    GridDisplay<LCD_COLS, LCD_ROWS> display;
+    CharacterDisplayRenderer renderer(&display, LCD_COLS, LCD_ROWS);
+    LcdMenu menu(renderer);
+
+    assertEqual(&systemClock(), menu.getClock());
+    renderer.setClock(&clock);
+    assertEqual(&clock, menu.getClock());
+    renderer.setClock(NULL);
+    assertEqual(&systemClock(), renderer.getClock());
+}
+
+unittest_main()
@@ -0,0 +1,122 @@
+#include <ArduinoUnitTests.h>
+#include <LcdMenu.h>
+#include <MenuScreen.h>
+
+#include "support/MenuFixture.h"
+
+#define LCD_ROWS 2
+#define LCD_COLS 16
+
+// Power states of the display: every change is sent once, nothing is sent
+// while the state stays the same.
+
+class RecordingItem : public MenuItem {
+  public:
+    uint16_t draws = 0;
+    uint16_t commands = 0;
+    RecordingItem() : MenuItem("Polled") { polling = true; }
+    void draw(MenuRenderer*) override { draws++; }
+    bool process(LcdMenu*, const unsigned char) override {
+        commands++;
+        return true;
+    }
+};
+
+RecordingItem item;
+MenuScreen* screen = new MenuScreen({&item});
+
+struct Fixture : MenuFixture<LCD_COLS, LCD_ROWS> {
+    Fixture() {
+        renderer.setPowerTimeouts(5000, 20000);
+        start(screen);
+        item.draws = 0;
+        item.commands = 0;
+    }
+    // Power changes sent to the display
+    uint16_t powerWrites() const { return display.showCalls + display.hideCalls + display.backlightOn + display.backlightOff; }
+    // Calls updateTimer every millisecond for `ms` milliseconds
+    void idle(unsigned long ms) {
+        for (unsigned long t = 0; t < ms; t++) {
+            clock.advance(1);
+            renderer.updateTimer();
+        }
+    }
+};
+
+unittest(each_transition_is_sent_once) {
+    Fixture f;
+
+    f.idle(4999);
+    assertEqual(MenuRenderer::ACTIVE, f.renderer.getPowerState());
+    assertEqual(0, f.powerWrites());
+
+    f.idle(1);
+    assertEqual(MenuRenderer::DIMMED, f.renderer.getPowerState());
+    f.idle(14999);
+    assertEqual(1, f.display.backlightOff);
+    assertEqual(1, f.powerWrites());
+
+    f.idle(1);
+    assertEqual(MenuRenderer::OFF, f.renderer.getPowerState());
+    f.idle(30000);
+    assertEqual(1, f.display.hideCalls);
+    assertEqual(2, f.powerWrites());
+}
+
+unittest(input_while_active_sends_nothing_to_the_display) {
+    Fixture f;
+
+    for (uint8_t i = 0; i < 50; i++) {
+        f.clock.advance(100);
+        f.menu.process(DOWN);
+        f.renderer.updateTimer();
+    }
+
+    assertEqual(0, f.powerWrites());
+    assertEqual(50, item.commands);
+}
+
+unittest(wake_policy_decides_whether_the_waking_input_is_processed) {
+    Fixture f;
+    f.renderer.setWakePolicy(MenuRenderer::SWALLOW_WHEN_OFF);
+
+    // Dimmed: woken and processed
+    f.idle(5000);
+    assertTrue(f.menu.process(ENTER));
+    assertEqual(1, item.commands);
+    assertEqual(1, f.display.backlightOn);
+
+    // Off: woken and swallowed
+    f.idle(20000);
+    assertTrue(f.menu.process(ENTER));
+    assertEqual(1, item.commands);
+    assertEqual(1, f.display.showCalls);
+    assertEqual(MenuRenderer::ACTIVE, f.renderer.getPowerState());
+    assertTrue(f.menu.process(ENTER));
+    assertEqual(2, item.commands);
+
+    f.renderer.setWakePolicy(MenuRenderer::SWALLOW_WHEN_ASLEEP);
+    f.idle(5000);
+    assertTrue(f.menu.process(ENTER));
+    assertEqual(2, item.commands);
+}
+
+unittest(nothing_is_drawn_while_off) {
+    Fixture f;
+    f.idle(20000);
+    uint16_t drawsWhenOff = item.draws;
+
+    for (uint8_t i = 0; i < 10; i++) {
+        f.clock.advance(1000);
+        f.menu.poll(1000);
+        f.menu.refresh();
+    }
+    assertEqual(drawsWhenOff, item.draws);
+
+    // Redrawn once on wake up, then the command is processed
+    f.menu.process(ENTER);
+    assertEqual(drawsWhenOff + 1, item.draws);
+    assertEqual(1, item.commands);
+}
+
+unittest_main()
@@ -0,0 +1,82 @@
+#include <ArduinoUnitTests.h>
+#include <ItemBool.h>
+#include <ItemRange.h>
+#include <ItemToggle.h>
+#include <ItemWidget.h>
+#include <LcdMenu.h>
+#include <MenuScreen.h>
+#include <diagnostics/MemoryReport.h>
+
+#include "support/MenuFixture.h"
+
+#define LCD_ROWS 4
+#define LCD_COLS 16
+
+// Texts given with F("...") are drawn like texts in RAM and take no RAM
+
+// clang-format off
+MENU_SCREEN(flashScreen, flashItems,
+    ITEM_BASIC(F("Settings")),
+    ITEM_RANGE<int>(F("Volume"), 5, 1, 0, 10, NULL, F("%d%%")),
+    ITEM_BOOL(F("Light"), true, F("On"), F("Off"), NULL),
+    ITEM_TOGGLE(F("Fan"), F("Run"), F("Stop"), NULL));
+
+MENU_SCREEN(ramScreen, ramItems,
+    ITEM_BASIC("Settings"),
+    ITEM_RANGE<int>("Volume", 5, 1, 0, 10, NULL, "%d%%"),
+    ITEM_BOOL("Light", true, "On", "Off", NULL),
+    ITEM_TOGGLE("Fan", "Run", "Stop", NULL));
+// clang-format on
+
+unittest(flash_texts_are_drawn) {
+    MenuFixture<LCD_COLS, LCD_ROWS> f;
+    f.start(flashScreen);
+
+    assertEqual("~Settings       ", f.display.cells[0]);
+    assertEqual(" Volume:5%      ", f.display.cells[1]);
+    assertEqual(" Light:On       ", f.display.cells[2]);
+    assertEqual(" Fan:Stop       ", f.display.cells[3]);
+}
+
+unittest(flash_texts_are_flagged) {
+    assertTrue(flashItems[0]->isTextInFlash());
+    assertFalse(ramItems[0]->isTextInFlash());
+    assertEqual(ramItems[0]->getText(), "Settings");
+
+    MenuText text(F("Volume"));
+    char buffer[4];
+    assertEqual(6, text.length());
+    assertEqual("Vol", text.load(buffer, sizeof(buffer)));
+}
+
+unittest(flash_texts_take_no_ram) {
+    MemoryReport flash;
+    flashScreen->report(flash);
+    MemoryReport ram;
+    ramScreen->report(ram);
+
+    // Only the default "%s" format of ITEM_BOOL is left in RAM
+    assertEqual(3, flash.get(MemoryReport::TEXT).bytes);
+    assertEqual(9 + 7 + 5 + 6 + 3 + 4 + 3 + 4 + 4 + 5, ram.get(MemoryReport::TEXT).bytes);
+}
+
+#if LCDMENU_VIEW_SHIFT
+// Longer than the copy a text in flash is drawn from
+// clang-format off
+MENU_SCREEN(longScreen, longItems,
+    ITEM_WIDGET(F("Volume of the second speaker"), NULL, WIDGET_RANGE(5, 1, 0, 9, "%d")));
+// clang-format on
+
+unittest(long_flash_label_is_shifted_as_drawn) {
+    MenuFixture<LCD_COLS, LCD_ROWS> f;
+    f.start(longScreen);
+
+    f.menu.process(ENTER);
+    // The label is cut to 24 characters, the value shows right after it
+    assertEqual(24, ITEM_DRAW_BUFFER_SIZE - 1);
+    assertEqual("\x7F" "e second spe:5 ", f.display.cells[0]);
+    f.menu.process(BACK);
+}
+#endif
+
+unittest_main()
@@ -0,0 +1,111 @@
+#define protected public
+#include <ItemInputCharset.h>
+#undef protected
+#include "support/AllocationCounter.h"
+#include "support/GridDisplay.h"
+#include <ArduinoUnitTests.h>
+#include <ItemSubMenu.h>
+#include <ItemWidget.h>
+#include <LcdMenu.h>
+#include <MenuScreen.h>
+#include <renderer/CharacterDisplayRenderer.h>
+#include <widget/WidgetBool.h>
+#include <widget/WidgetRange.h>
+
+#define LCD_ROWS 2
+#define LCD_COLS 16
+
+// Checks that the menu does not touch the heap once it is built, and that
+// the input items free the buffers they allocate.
+
+char name[] = "LcdMenu";
+
+extern MenuScreen* settingsScreen;
+
+// clang-format off
+MENU_SCREEN(mainScreen, mainItems,
+    ITEM_INPUT("Name", name, NULL),
+    ITEM_SUBMENU("Settings", settingsScreen),
+    ITEM_WIDGET(
+        "Volume",
+        [](int) {},
+        WIDGET_RANGE(5, 1, 0, 10, "%d", 0, false)),
+    ITEM_BASIC("Info"),
+    ITEM_BASIC("About"));
+
+MENU_SCREEN(settingsScreen, settingsItems,
+    ITEM_WIDGET(
+        "Sound",
+        [](bool) {},
+        WIDGET_BOOL(true, "On", "Off", "%s")),
+    ITEM_BASIC("Reset"));
+// clang-format on
+
+unittest(navigating_screens_does_not_allocate) {
+    GridDisplay<LCD_COLS, LCD_ROWS> display;
+    CharacterDisplayRenderer renderer(&display, LCD_COLS, LCD_ROWS);
+    LcdMenu menu(renderer);
+    menu.setScreen(mainScreen);
+
+    AllocationScope heap;
+    const unsigned char commands[] = {
+        DOWN, DOWN, DOWN, DOWN, UP, UP,     // scroll with view shifts
+        ENTER, UP, UP, DOWN, BACK,          // edit a widget
+        UP, ENTER, DOWN, ENTER, ENTER, BACK, // sub menu and back
+        UP, ENTER, LEFT, RIGHT, BACK,       // input without typing
+    };
+    for (unsigned char command : commands) {
+        menu.process(command);
+    }
+    size_t allocations = heap.allocations();
+
+    assertEqual(0, allocations);
+}
+
+unittest(typing_grows_input_buffer_by_doubling) {
+    GridDisplay<LCD_COLS, LCD_ROWS> display;
+    CharacterDisplayRenderer renderer(&display, LCD_COLS, LCD_ROWS);
+    LcdMenu menu(renderer);
+    ItemInput item("Name", NULL);
+
+    AllocationScope heap;
+    item.process(&menu, ENTER);
+    const char* typed = "abcdefghijklmnopqrstu";
+    for (const char* c = typed; *c != '\0'; c++) {
+        item.process(&menu, *c);
+    }
+    item.process(&menu, BACK);
+    size_t allocations = heap.allocations();
+    size_t frees = heap.frees();
+
+    assertEqual(typed, item.getValue());
+    // 8, 16 and 32 bytes, the first two are freed when outgrown
+    assertEqual(3, allocations);
+    assertEqual(2, frees);
+    assertEqual(32, heap.leakedBytes());
+}
+
+unittest(input_items_free_their_buffers) {
+    GridDisplay<LCD_COLS, LCD_ROWS> display;
+    CharacterDisplayRenderer renderer(&display, LCD_COLS, LCD_ROWS);
+    LcdMenu menu(renderer);
+
+    AllocationScope heap;
+    ItemInputCharset* item = new ItemInputCharset("Pin", (char*)"12", "0123456789", NULL);
+    item->process(&menu, ENTER);
+    item->process(&menu, UP);     // charset edit after the last char
+    item->process(&menu, ENTER);  // appends the char
+    item->process(&menu, BACKSPACE);
+    item->process(&menu, CLEAR);
+    item->process(&menu, BACK);
+    item->setValue((char*)"34");
+    delete item;
+    size_t allocations = heap.allocations();
+    size_t frees = heap.frees();
+
+    assertEqual(allocations, frees);
+    assertEqual(0, heap.leakedBytes());
+    assertMoreOrEqual(heap.peakBytes(), sizeof(ItemInputCharset) + 8);
+}
+
+unittest_main()
@@ -0,0 +1,154 @@
+#include <ArduinoUnitTests.h>
+#include <LcdMenu.h>
+#include <MenuScreen.h>
+#include <input/InputRecorder.h>
+#include <input/ReplayAdapter.h>
+
+#include "support/MenuFixture.h"
+
+#define LCD_ROWS 2
+#define LCD_COLS 16
+
+// Keeps every command it receives
+class RecordingItem : public MenuItem {
+  public:
+    std::string received;
+    RecordingItem() : MenuItem("Recorder") {}
+    bool process(LcdMenu*, const unsigned char command) override {
+        received.push_back(static_cast<char>(command));
+        return true;
+    }
+};
+
+// Sends one command of its script per observe
+class ScriptAdapter : public InputInterface {
+  public:
+    const char* script;
+    ScriptAdapter(LcdMenu* menu, const char* script) : InputInterface(menu), script(script) {}
+    void observe() override {
+        if (*script) dispatch(*script++);
+    }
+};
+
+class CapturePrint : public Print {
+  public:
+    std::string captured;
+    size_t write(uint8_t byte) override {
+        captured.push_back(static_cast<char>(byte));
+        return 1;
+    }
+};
+
+RecordingItem item;
+MenuScreen* screen = new MenuScreen({&item});
+
+struct Fixture : MenuFixture<LCD_COLS, LCD_ROWS> {
+    Fixture() {
+        start(screen);
+        item.received.clear();
+    }
+};
+
+unittest(recorder_passes_commands_on_and_records_delays) {
+    Fixture f;
+    uint8_t storage[3 * 8];
+    InputRecording recording(storage, sizeof(storage));
+    ScriptAdapter keys(&f.menu, "abc");
+    InputRecorder recorder(&f.menu, &keys, &recording);
+
+    recorder.start();
+    f.clock.advance(40);
+    recorder.observe();
+    f.clock.advance(120);
+    recorder.observe();
+    f.clock.advance(70000);
+    recorder.observe();
+
+    assertEqual("abc", item.received);
+    assertEqual(3, recording.size());
+    assertEqual('b', recording.getCommand(1));
+    assertEqual(40, recording.getDelay(0));
+    assertEqual(120, recording.getDelay(1));
+    // Delays are capped
+    assertEqual(0xFFFF, recording.getDelay(2));
+}
+
+unittest(recording_drops_commands_when_full) {
+    uint8_t storage[7];
+    InputRecording recording(storage, sizeof(storage));
+
+    assertEqual(2, recording.getCapacity());
+    assertTrue(recording.record(UP, 0));
+    assertTrue(recording.record(DOWN, 10));
+    assertFalse(recording.hasOverflowed());
+    assertFalse(recording.record(ENTER, 20));
+    assertTrue(recording.hasOverflowed());
+    assertEqual(2, recording.size());
+
+    recording.clear();
+    assertEqual(0, recording.size());
+    assertFalse(recording.hasOverflowed());
+}
+
+unittest(replay_in_real_time_follows_the_delays) {
+    Fixture f;
+    uint8_t storage[3 * 4];
+    InputRecording recording(storage, sizeof(storage));
+    recording.start(0);
+    recording.record('a', 100);
+    recording.record('b', 100);
+    recording.record('c', 350);
+    ReplayAdapter replay(&f.menu, &recording);
+
+    replay.play();
+    f.clock.advance(99);
+    replay.observe();
+    assertEqual("", item.received);
+    // 'a' and 'b' are both due
+    f.clock.advance(1);
+    replay.observe();
+    assertEqual("ab", item.received);
+    f.clock.advance(249);
+    replay.observe();
+    assertEqual("ab", item.received);
+    f.clock.advance(1);
+    replay.observe();
+    assertEqual("abc", item.received);
+    assertFalse(replay.isPlaying());
+}
+
+unittest(replay_at_full_speed_ignores_the_delays) {
+    Fixture f;
+    uint8_t storage[3 * 4];
+    InputRecording recording(storage, sizeof(storage));
+    recording.record(DOWN, 0);
+    recording.record(UP, 5000);
+    recording.record(ENTER, 5000);
+    ReplayAdapter replay(&f.menu, &recording, ReplayAdapter::FULL_SPEED);
+
+    replay.setLoop(true);
+    replay.play();
+    for (uint8_t i = 0; i < 4; i++) replay.observe();
+    assertEqual(4, item.received.size());
+    assertEqual(DOWN, (unsigned char)item.received[3]);
+    assertTrue(replay.isPlaying());
+
+    replay.replayAll();
+    assertEqual(6, item.received.size());
+    assertFalse(replay.isPlaying());
+}
+
+unittest(recording_prints_replayable_tokens) {
+    uint8_t storage[3 * 4];
+    InputRecording recording(storage, sizeof(storage));
+    CapturePrint out;
+    recording.record(DOWN, 0);
+    recording.record('x', 250);
+    recording.record(0x01, 260);
+
+    recording.printTo(out);
+
+    assertEqual("+0ms DOWN\r\n+250ms x\r\n+10ms 0x01\r\n", out.captured);
+}
+
+unittest_main()
@@ -0,0 +1,116 @@
+#include <ArduinoUnitTests.h>
+#include <ItemBar.h>
+#include <LcdMenu.h>
+#include <MenuScreen.h>
+
+#include "support/MenuFixture.h"
+
+#define LCD_ROWS 2
+#define LCD_COLS 16
+
+// Bars with 5 columns per cell, redrawn cell by cell.
+
+// The bar of "Tank" starts after the cursor, the text and the colon
+#define BAR_COL 6
+
+uint8_t level = 0;
+ObservableValue<int> power(0);
+// clang-format off
+MENU_SCREEN(barScreen, barItems,
+    ITEM_BAR("Tank", level, (uint8_t)0, (uint8_t)100, 8),
+    ITEM_BAR("Powr", power, 0, 80, 8));
+// clang-format on
+
+struct Fixture : MenuFixture<LCD_COLS, LCD_ROWS> {
+    Fixture(bool glyphs = true) {
+        if (glyphs) renderer.setBarGlyphs(3);
+        start(barScreen);
+        display.resetCounts();
+    }
+    void poll() {
+        clock.advance(1000);
+        menu.poll(1000);
+    }
+};
+
+unittest(cells_are_filled_by_columns) {
+    level = 45;
+    Fixture f;
+    f.menu.refresh();
+    // 18 of 40 columns: 3 full cells, then 3 columns
+    for (uint8_t i = 0; i < 3; i++) assertEqual('\xFF', f.display.cells[0][BAR_COL + i]);
+    assertEqual(5, f.display.cells[0][BAR_COL + 3]);
+    assertEqual(' ', f.display.cells[0][BAR_COL + 4]);
+    assertEqual(0x1C, f.display.glyphs[5][0]);
+    assertEqual(0x10, f.display.glyphs[3][7]);
+}
+
+unittest(only_changed_cells_are_sent) {
+    level = 45;
+    Fixture f;
+    level = 50;
+    f.poll();
+    assertEqual(1, f.display.writes);
+    assertEqual(1, f.display.cursorMoves);
+    assertEqual('\xFF', f.display.cells[0][BAR_COL + 3]);
+
+    // Two cells next to each other, one cursor move
+    f.display.resetCounts();
+    level = 55;
+    f.poll();
+    assertEqual(1, f.display.writes);
+    f.display.resetCounts();
+    level = 45;
+    f.poll();
+    assertEqual(2, f.display.writes);
+    assertEqual(1, f.display.cursorMoves);
+    assertEqual(5, f.display.cells[0][BAR_COL + 3]);
+    assertEqual(' ', f.display.cells[0][BAR_COL + 4]);
+
+    f.display.resetCounts();
+    f.poll();
+    assertEqual(0, f.display.writes);
+}
+
+unittest(observable_bar_is_redrawn_when_set) {
+    level = 0;
+    power.set(0);
+    Fixture f;
+    power.set(20);
+    f.menu.refreshDirty();
+    // 10 of 40 columns, two cells
+    assertEqual(2, f.display.writes);
+    assertEqual('\xFF', f.display.cells[1][BAR_COL]);
+    assertEqual('\xFF', f.display.cells[1][BAR_COL + 1]);
+    assertEqual(' ', f.display.cells[1][BAR_COL + 2]);
+}
+
+unittest(full_cells_only_without_glyphs) {
+    level = 45;
+    Fixture f(false);
+    f.menu.refresh();
+    for (uint8_t i = 0; i < 4; i++) assertEqual('\xFF', f.display.cells[0][BAR_COL + i]);
+    assertEqual(' ', f.display.cells[0][BAR_COL + 4]);
+}
+
+unittest(glyph_slots_of_the_arrows_are_refused) {
+    level = 45;
+    uint8_t downArrow[8];
+    Fixture f(false);
+    memcpy(downArrow, f.display.glyphs[1], 8);
+
+    // Slot 1 holds the down arrow, slots past 4 leave no room for 4 glyphs
+    for (uint8_t slot : {1, 5, 7}) {
+        f.display.resetCounts();
+        f.renderer.setBarGlyphs(slot);
+        assertEqual(0, f.display.uploads);
+        f.menu.refresh();
+        assertEqual('\xFF', f.display.cells[0][BAR_COL + 3]);
+    }
+    assertEqual(0, memcmp(downArrow, f.display.glyphs[1], 8));
+
+    f.renderer.setAnimation(1, (const uint8_t(*)[8])downArrow, 1);
+    assertEqual(0, f.display.uploads);
+}
+
+unittest_main()
@@ -52,6 +52,7 @@ unittest(item_value_updates_after_poll) {
 
     GODMODE()->micros = 200000;  // advance time
     menu.poll(100);
+    assertEqual("Temp", renderer.lastText.c_str());
     assertEqual("0.0", renderer.lastValue.c_str());
 
     tracked = 42.5;
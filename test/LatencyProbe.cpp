@@ -0,0 +1,97 @@
+#include "Godmode.h"
+#include <ArduinoUnitTests.h>
+#include <LcdMenu.h>
+#include <MenuScreen.h>
+#include <diagnostics/LatencyProbe.h>
+#include <renderer/MenuRenderer.h>
+
+#include "support/GridDisplay.h"
+
+class StubRenderer : public MenuRenderer {
+  public:
+    GridDisplay<16, 2> display;
+    StubRenderer() : MenuRenderer(&display, 16, 2) {}
+    void draw(uint8_t) override {}
+    void drawItem(const char*, const char*, bool) override {}
+    void clearBlinker() override {}
+    void drawBlinker() override {}
+    uint8_t getEffectiveCols() const override { return maxCols; }
+};
+
+/**
+ * Takes 70 ms to handle ENTER, like a slow I2C redraw.
+ */
+class SlowItem : public MenuItem {
+  public:
+    SlowItem(const char* text) : MenuItem(text) {}
+
+  protected:
+    bool process(LcdMenu*, const unsigned char command) override {
+        if (command != ENTER) return false;
+        GODMODE()->micros += 70000;
+        return true;
+    }
+};
+
+unittest(latency_probe_fills_buckets_per_command) {
+    LatencyProbe probe;
+    GODMODE()->micros = 1000000;
+    probe.begin(UP, NULL);
+    GODMODE()->micros += 3000;
+    probe.end();
+    probe.begin('a', NULL);
+    GODMODE()->micros += 500;
+    probe.end();
+
+    const LatencyProbe::Stats& up = probe.get(LatencyProbe::CMD_UP);
+    assertEqual(1, up.count);
+    // 2 ms <= 3 ms < 5 ms
+    assertEqual(1, up.buckets[2]);
+    assertEqual(3000, up.maxMicros);
+    assertEqual(0, up.overBudget);
+    assertEqual(1, probe.get(LatencyProbe::CMD_PRINTABLE).buckets[0]);
+    assertEqual(0, probe.get(LatencyProbe::CMD_DOWN).count);
+}
+
+unittest(latency_probe_counts_slow_commands_over_budget) {
+    LatencyProbe probe;
+    GODMODE()->micros = 1000000;
+    probe.begin(DOWN, NULL);
+    GODMODE()->micros += 120000;
+    probe.end();
+    const LatencyProbe::Stats& down = probe.get(LatencyProbe::CMD_DOWN);
+    assertEqual(1, down.count);
+    assertEqual(1, down.buckets[LatencyProbe::BUCKET_COUNT - 1]);
+    assertEqual(1, down.overBudget);
+}
+
+// clang-format off
+MENU_SCREEN(mainScreen, mainItems,
+    ITEM_BASIC("Fast"),
+    new SlowItem("Slow"));
+// clang-format on
+
+unittest(latency_probe_reports_slowest_item) {
+    StubRenderer renderer;
+    LcdMenu menu(renderer);
+    LatencyProbe probe;
+    menu.setScreen(mainScreen);
+    menu.setLatencyProbe(&probe);
+
+    menu.process(ENTER);
+    menu.process(DOWN);
+    menu.process(ENTER);
+
+    const LatencyProbe::Stats& enter = probe.get(LatencyProbe::CMD_ENTER);
+    assertEqual(2, enter.count);
+    assertEqual(1, enter.overBudget);
+    assertEqual(70000, enter.maxMicros);
+    assertEqual("Slow", enter.slowestItem->getText());
+    assertEqual(1, probe.get(LatencyProbe::CMD_DOWN).count);
+
+    menu.setLatencyProbe(NULL);
+    menu.process(UP);
+    assertEqual(0, probe.get(LatencyProbe::CMD_UP).count);
+}
+
+unittest_main()
@@ -139,7 +139,7 @@ unittest(show_enables_and_draws_active_screen) {
     renderer.itemDrawn = false;
     menu.show();
     assertTrue(menu.isEnabled());
-    assertTrue(renderer.display.cleared);
+    assertFalse(renderer.display.cleared);
     assertTrue(renderer.itemDrawn);
 }
 
@@ -0,0 +1,75 @@
+#include <ArduinoUnitTests.h>
+#include <ItemInput.h>
+#include <ItemWidget.h>
+#include <LcdMenu.h>
+#include <MenuScreen.h>
+#include <diagnostics/MemoryReport.h>
+#include <renderer/CharacterDisplayRenderer.h>
+#include <widget/WidgetList.h>
+#include <widget/WidgetRange.h>
+
+#include "support/GridDisplay.h"
+
+std::vector<const char*> days = {"Mon", "Tue", "Wed"};
+char name[] = "Sensor";
+
+// clang-format off
+MENU_SCREEN(basicScreen, basicItems,
+    ITEM_BASIC("One"),
+    ITEM_BASIC("Two"),
+    ITEM_BASIC("Three"));
+
+MENU_SCREEN(widgetScreen, widgetItems,
+    ITEM_INPUT("Name", name, [](char* value) {}),
+    ITEM_WIDGET(
+        "Alarm",
+        [](int hour, const uint8_t day) {},
+        WIDGET_RANGE(7, 1, 0, 23, "%02d", 0, true),
+        WIDGET_LIST(days, 0, " %s", 0, true)));
+// clang-format on
+
+unittest(screen_report_counts_items_and_texts) {
+    MemoryReport report;
+    basicScreen->report(report);
+
+    assertEqual(1, report.get(MemoryReport::SCREEN).count);
+    assertEqual(sizeof(MenuScreen) + basicItems.size() * sizeof(MenuItem*), report.get(MemoryReport::SCREEN).bytes);
+    assertEqual(3, report.get(MemoryReport::ITEM).count);
+    assertEqual(3 * sizeof(MenuItem), report.get(MemoryReport::ITEM).bytes);
+    assertEqual(4 + 4 + 6, report.get(MemoryReport::TEXT).bytes);
+    assertEqual(0, report.get(MemoryReport::WIDGET).count);
+}
+
+unittest(screen_report_includes_widgets_and_values) {
+    MemoryReport report;
+    widgetScreen->report(report);
+
+    assertEqual(2, report.get(MemoryReport::ITEM).count);
+    assertEqual(2, report.get(MemoryReport::WIDGET).count);
+    // "07 Mon"
+    assertEqual(6, report.getLongestValue());
+    // Item texts, input value and widget formats
+    assertEqual(5 + 6 + 7 + 5 + 4, report.get(MemoryReport::TEXT).bytes);
+}
+
+unittest(menu_report_adds_menu_renderer_and_current_screen) {
+    GridDisplay<16, 2> display;
+    CharacterDisplayRenderer renderer(&display, 16, 2);
+    LcdMenu menu(renderer);
+    menu.setScreen(basicScreen);
+
+    MemoryReport report;
+    menu.memoryReport(report);
+
+    assertEqual(sizeof(LcdMenu), report.get(MemoryReport::MENU).bytes);
+    assertEqual(sizeof(CharacterDisplayRenderer) + 16, report.get(MemoryReport::RENDERER).bytes);
+    assertEqual(1, report.get(MemoryReport::SCREEN).count);
+    assertEqual(3, report.get(MemoryReport::ITEM).count);
+
+    size_t total = report.total();
+    widgetScreen->report(report);
+    assertMore(report.total(), total);
+    assertEqual(2, report.get(MemoryReport::SCREEN).count);
+}
+
+unittest_main()
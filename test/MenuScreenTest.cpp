@@ -112,4 +112,18 @@ unittest(menu_screen_draw_clamps_view) {
     delete i5;
 }
 
+unittest(menu_screen_process_on_empty_screen) {
+    MenuScreen screen(std::vector<MenuItem*>{});
+    StubRenderer renderer;
+    LcdMenu menu(renderer);
+    menu.setScreen(&screen);
+
+    assertFalse(screen.process(&menu, ENTER));
+    assertTrue(screen.process(&menu, DOWN));
+    assertTrue(screen.process(&menu, UP));
+    assertTrue(screen.process(&menu, BACK));
+    assertEqual((uint8_t)0, screen.getCursor());
+    assertEqual((uint8_t)0, screen.getView());
+}
+
 unittest_main()
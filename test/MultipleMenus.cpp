@@ -0,0 +1,128 @@
+#include <ArduinoUnitTests.h>
+#include <ItemInput.h>
+#include <LcdMenu.h>
+#include <MenuScreen.h>
+#include <renderer/CharacterDisplayRenderer.h>
+
+#include "support/GridDisplay.h"
+
+// The same screens shown by two menus on two displays.
+
+class PolledItem : public MenuItem {
+  public:
+    uint16_t draws = 0;
+    MenuRenderer* lastRenderer = NULL;
+    PolledItem(const char* text) : MenuItem(text) { polling = true; }
+    void draw(MenuRenderer* renderer) override {
+        draws++;
+        lastRenderer = renderer;
+        MenuItem::draw(renderer);
+    }
+};
+
+char name[10] = "Pump";
+ItemInput nameInput("Name", name, NULL);
+PolledItem rpm("RPM");
+MenuItem flow("Flow");
+MenuItem pressure("Press");
+MenuItem level("Level");
+MenuScreen* screen = new MenuScreen({&nameInput, &rpm, &flow, &pressure, &level});
+
+struct Fixture {
+    SimulatedClock clock;
+    GridDisplay<16, 4> frontDisplay;
+    GridDisplay<16, 2> backDisplay;
+    CharacterDisplayRenderer frontRenderer;
+    CharacterDisplayRenderer backRenderer;
+    LcdMenu front;
+    LcdMenu back;
+    Fixture()
+        : frontRenderer(&frontDisplay, 16, 4),
+          backRenderer(&backDisplay, 16, 2),
+          front(frontRenderer),
+          back(backRenderer) {
+        frontRenderer.setClock(&clock);
+        backRenderer.setClock(&clock);
+        front.setScreen(screen);
+        back.setScreen(screen);
+        rpm.draws = 0;
+    }
+};
+
+unittest(each_menu_has_its_own_cursor_and_view) {
+    Fixture f;
+    f.front.process(DOWN);
+    f.back.process(DOWN);
+    f.back.process(DOWN);
+    f.back.process(DOWN);
+
+    assertEqual((uint8_t)1, f.front.getCursor());
+    assertEqual((uint8_t)3, f.back.getCursor());
+    assertEqual((uint8_t)0, f.front.getScreen()->getView());
+    assertEqual((uint8_t)2, f.back.getScreen()->getView());
+
+    f.front.process(UP);
+    assertEqual((uint8_t)0, f.front.getCursor());
+    assertEqual((uint8_t)3, f.back.getCursor());
+}
+
+unittest(editing_on_one_menu_keeps_polling_the_other) {
+    Fixture f;
+    f.back.process(ENTER);
+    assertTrue(f.back.isEditing());
+    assertFalse(f.front.isEditing());
+    assertTrue(MenuItem::isEditing());
+
+    f.clock.advance(1000);
+    f.back.poll(1000);
+    assertEqual(0, rpm.draws);
+    f.front.poll(1000);
+    assertEqual(1, rpm.draws);
+    assertTrue(rpm.lastRenderer == &f.frontRenderer);
+
+    f.back.process(BACK);
+    assertFalse(f.back.isEditing());
+    assertFalse(MenuItem::isEditing());
+}
+
+unittest(an_item_is_edited_by_one_menu_at_a_time) {
+    Fixture f;
+    f.front.process(ENTER);
+    f.front.process(LEFT);
+    f.front.process(LEFT);
+
+    // The item keeps the edit of the front menu, the back menu stays on it
+    f.back.process(ENTER);
+    assertFalse(f.back.isEditing());
+    assertTrue(f.front.isEditing());
+    f.front.process('X');
+    assertEqual("PuXmp", nameInput.getValue());
+    f.front.process(BACKSPACE);
+
+    f.back.process(DOWN);
+    assertEqual((uint8_t)1, f.back.getCursor());
+    f.back.process(UP);
+
+    f.front.process(BACK);
+    f.back.process(ENTER);
+    assertTrue(f.back.isEditing());
+    f.back.process(BACK);
+    assertEqual("Pump", nameInput.getValue());
+}
+
+unittest(dirty_items_are_redrawn_on_every_menu) {
+    Fixture f;
+    f.back.process(DOWN);
+    rpm.draws = 0;
+    rpm.markDirty();
+
+    f.front.refreshDirty();
+    assertEqual(1, rpm.draws);
+    f.front.refreshDirty();
+    assertEqual(1, rpm.draws);
+    f.back.refreshDirty();
+    assertEqual(2, rpm.draws);
+    assertTrue(rpm.lastRenderer == &f.backRenderer);
+}
+
+unittest_main()
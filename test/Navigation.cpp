@@ -0,0 +1,141 @@
+#include <ArduinoUnitTests.h>
+#include <ItemBack.h>
+#include <ItemSubMenu.h>
+#include <LcdMenu.h>
+#include <MenuScreen.h>
+#include <display/ShadowDisplay.h>
+#include <renderer/CharacterDisplayRenderer.h>
+
+#include "support/GridDisplay.h"
+
+#define LCD_ROWS 2
+#define LCD_COLS 16
+
+// Submenus remember where their parent was left.
+
+extern MenuScreen* colorScreen;
+extern MenuScreen* settingsScreen;
+
+// clang-format off
+MENU_SCREEN(mainScreen, mainItems,
+    ITEM_BASIC("Start"),
+    ITEM_BASIC("Stop"),
+    ITEM_BASIC("Status"),
+    ITEM_BASIC("Logs"),
+    ITEM_SUBMENU("Settings", settingsScreen),
+    ITEM_BASIC("About"));
+MENU_SCREEN(settingsScreen, settingsItems,
+    ITEM_BASIC("Volume"),
+    ITEM_BASIC("Brightness"),
+    ITEM_SUBMENU("Colors", colorScreen),
+    ITEM_BACK());
+MENU_SCREEN(colorScreen, colorItems,
+    ITEM_BACK());
+// clang-format on
+
+struct Fixture {
+    GridDisplay<LCD_COLS, LCD_ROWS> panel;
+    ShadowDisplay shadow;
+    CharacterDisplayRenderer renderer;
+    LcdMenu menu;
+    Fixture(bool inPlace)
+        : shadow(&panel, LCD_COLS, LCD_ROWS, 0),
+          renderer(&shadow, LCD_COLS, LCD_ROWS),
+          menu(renderer) {
+        shadow.setSkipUnchanged(inPlace);
+        renderer.begin();
+        menu.setScreen(mainScreen);
+    }
+};
+
+unittest(back_restores_cursor_and_view) {
+    Fixture f(false);
+    for (uint8_t i = 0; i < 4; i++) f.menu.process(DOWN);
+    f.menu.process(ENTER);
+    assertTrue(f.menu.getScreen() == settingsScreen);
+    assertEqual((uint8_t)0, f.menu.getCursor());
+
+    f.menu.process(DOWN);
+    f.menu.process(DOWN);
+    f.menu.process(ENTER);
+    assertTrue(f.menu.getScreen() == colorScreen);
+
+    f.menu.process(BACK);
+    assertTrue(f.menu.getScreen() == settingsScreen);
+    assertEqual((uint8_t)2, f.menu.getCursor());
+    assertEqual((uint8_t)1, f.menu.getScreen()->getView());
+
+    f.menu.process(BACK);
+    assertTrue(f.menu.getScreen() == mainScreen);
+    assertEqual((uint8_t)4, f.menu.getCursor());
+    assertEqual((uint8_t)3, f.menu.getScreen()->getView());
+    assertTrue(f.panel.shows(0, " Logs"));
+    assertTrue(f.panel.shows(1, "~Settings"));
+}
+
+unittest(set_screen_forgets_the_history) {
+    Fixture f(false);
+    for (uint8_t i = 0; i < 4; i++) f.menu.process(DOWN);
+    f.menu.process(ENTER);
+    f.menu.setScreen(settingsScreen);
+
+    // Only the parent is left, shown from the top
+    f.menu.process(BACK);
+    assertTrue(f.menu.getScreen() == mainScreen);
+    assertEqual((uint8_t)0, f.menu.getCursor());
+}
+
+unittest(screens_are_redrawn_without_clearing) {
+    Fixture plain(false);
+    Fixture diffed(true);
+    for (Fixture* f : {&plain, &diffed}) {
+        for (uint8_t i = 0; i < 4; i++) f->menu.process(DOWN);
+        f->panel.clears = 0;
+        f->panel.writes = 0;
+        f->menu.process(ENTER);
+        f->menu.process(DOWN);
+        f->menu.process(DOWN);
+        f->menu.process(ENTER);
+        f->menu.process(BACK);
+        f->menu.process(BACK);
+    }
+
+    assertEqual(0, plain.panel.clears);
+    assertEqual(0, diffed.panel.clears);
+    // Only the changed characters are sent to a shadow display
+    assertLess(diffed.panel.writes, plain.panel.writes);
+    for (uint8_t r = 0; r < LCD_ROWS; r++) {
+        assertEqual(0, strncmp(plain.panel.cells[r], diffed.panel.cells[r], LCD_COLS));
+    }
+}
+
+unittest(empty_rows_are_blanked) {
+    for (bool diffed : {false, true}) {
+        Fixture f(diffed);
+        for (uint8_t i = 0; i < 4; i++) f.menu.process(DOWN);
+        f.menu.process(ENTER);
+        f.menu.process(DOWN);
+        f.menu.process(DOWN);
+        f.menu.process(ENTER);
+
+        assertTrue(f.panel.shows(0, "~..             "));
+        assertTrue(f.panel.shows(1, "                "));
+    }
+}
+
+unittest(show_draws_over_the_sketch_content) {
+    Fixture f(false);
+    f.menu.hide();
+    assertEqual(1, f.panel.clears);
+    f.panel.setCursor(0, 1);
+    f.panel.draw("Hello from loop");
+
+    f.menu.show();
+    assertEqual(1, f.panel.clears);
+    assertTrue(f.panel.shows(0, "~Start          "));
+    // The last column shows the arrow to the items below
+    assertTrue(f.panel.shows(1, " Stop          "));
+    assertEqual(1, f.panel.cells[1][LCD_COLS - 1]);
+}
+
+unittest_main()
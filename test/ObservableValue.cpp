@@ -0,0 +1,137 @@
+#include <ArduinoUnitTests.h>
+#include <ItemValue.h>
+#include <LcdMenu.h>
+#include <MenuScreen.h>
+#include <ObservableValue.h>
+#include <renderer/MenuRenderer.h>
+
+#include "support/MenuFixture.h"
+
+#define LCD_ROWS 4
+#define LCD_COLS 16
+
+// Items bound to an observable value are redrawn when it is set, not polled.
+
+class CountingRenderer : public MenuRenderer {
+  public:
+    std::string drawn;
+    CountingRenderer(DisplayInterface* display, uint8_t maxCols, uint8_t maxRows) : MenuRenderer(display, maxCols, maxRows) {}
+    void draw(uint8_t) override {}
+    void drawItem(const char* text, const char* value, bool) override {
+        drawn += text;
+        drawn += value != NULL ? value : "";
+        drawn += ';';
+    }
+    void clearBlinker() override {}
+    void drawBlinker() override {}
+    uint8_t getEffectiveCols() const override { return maxCols; }
+};
+
+ObservableValue<int> rpm(1200);
+ObservableValue<int> gear(1);
+float tracked = 20.5f;
+
+// clang-format off
+MENU_SCREEN(dashboard, dashboardItems,
+    ITEM_VALUE("RPM", rpm, "%d"),
+    ITEM_VALUE("Gear", gear, "%d"),
+    ITEM_VALUE("Temp", tracked, "%.1f"),
+    ITEM_BASIC("Label"));
+// clang-format on
+
+struct Fixture : MenuFixture<LCD_COLS, LCD_ROWS, CountingRenderer> {
+    Fixture() {
+        start(dashboard);
+        rpm.setSynchronous(NULL);
+        renderer.drawn.clear();
+    }
+};
+
+unittest(observed_items_are_not_polled) {
+    Fixture f;
+    for (uint8_t i = 0; i < 10; i++) {
+        f.clock.advance(1000);
+        f.menu.poll(1000);
+    }
+    assertEqual("Temp20.5;Temp20.5;Temp20.5;Temp20.5;Temp20.5;Temp20.5;Temp20.5;Temp20.5;Temp20.5;Temp20.5;",
+                f.renderer.drawn.c_str());
+}
+
+unittest(set_redraws_only_the_observers_on_the_next_poll) {
+    Fixture f;
+    f.clock.advance(500);
+    rpm.set(3000);
+    gear.set(1);
+    assertEqual("", f.renderer.drawn.c_str());
+
+    f.menu.poll(1000);
+    assertEqual("RPM3000;", f.renderer.drawn.c_str());
+    f.menu.poll(1000);
+    assertEqual("RPM3000;", f.renderer.drawn.c_str());
+}
+
+unittest(synchronous_mode_redraws_on_set) {
+    Fixture f;
+    rpm.setSynchronous(&f.menu);
+
+    rpm.set(4500);
+    assertEqual("RPM4500;", f.renderer.drawn.c_str());
+
+    f.renderer.beginEdit();
+    rpm.set(5000);
+    f.renderer.endEdit();
+    assertEqual("RPM4500;", f.renderer.drawn.c_str());
+    // Still dirty after editing
+    f.menu.poll(1000);
+    assertEqual("RPM4500;RPM5000;", f.renderer.drawn.c_str());
+}
+
+ObservableValue<int> speed(0);
+// clang-format off
+MENU_SCREEN(speedScreen, speedItems,
+    ITEM_VALUE("A", speed, "%d"),
+    ITEM_VALUE("B", speed, "%d"),
+    ITEM_VALUE("C", speed, "%d"));
+// clang-format on
+
+unittest(items_past_the_observer_limit_are_polled) {
+    assertEqual(2, OBSERVABLE_VALUE_OBSERVERS);
+    Fixture f;
+    f.menu.setScreen(speedScreen);
+    f.renderer.drawn.clear();
+
+    speed.set(7);
+    f.clock.advance(1000);
+    // The two observers are redrawn first, the polled item on the next tick
+    f.menu.poll(1000);
+    f.menu.poll(1000);
+    assertEqual("A7;B7;C7;", f.renderer.drawn.c_str());
+}
+
+unittest(deleted_items_stop_observing) {
+    ObservableValue<int> gauge(0);
+    MenuItem* first = ITEM_VALUE("X", gauge, "%d");
+    MenuItem* second = ITEM_VALUE("Y", gauge, "%d");
+    delete first;
+    // The slot of the deleted item is free again
+    MenuItem* third = ITEM_VALUE("Z", gauge, "%d");
+    MenuScreen* screen = new MenuScreen({second, third});
+    Fixture f;
+    f.menu.setScreen(screen);
+    f.renderer.drawn.clear();
+
+    gauge.set(1);
+    f.menu.refreshDirty();
+    assertEqual("Y1;Z1;", f.renderer.drawn.c_str());
+    // Observed, not polled
+    f.clock.advance(1000);
+    f.menu.poll(1000);
+    assertEqual("Y1;Z1;", f.renderer.drawn.c_str());
+
+    f.menu.setScreen(dashboard);
+    delete screen;
+    delete second;
+    delete third;
+}
+
+unittest_main()
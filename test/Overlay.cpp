@@ -0,0 +1,125 @@
+#include <ArduinoUnitTests.h>
+#include <LcdMenu.h>
+#include <MenuScreen.h>
+
+#include "support/MenuFixture.h"
+
+#define LCD_ROWS 2
+#define LCD_COLS 16
+
+// Messages shown over the menu.
+
+// clang-format off
+MENU_SCREEN(mainScreen, mainItems,
+    ITEM_BASIC("Start"),
+    ITEM_BASIC("Stop"),
+    ITEM_BASIC("Reset"));
+// clang-format on
+
+int answers = 0;
+bool lastAnswer = false;
+void answer(bool yes) {
+    answers++;
+    lastAnswer = yes;
+}
+
+struct Fixture : MenuFixture<LCD_COLS, LCD_ROWS> {
+    Fixture() {
+        start(mainScreen);
+        display.writes = 0;
+        answers = 0;
+    }
+};
+
+unittest(message_covers_the_last_row_until_it_times_out) {
+    Fixture f;
+    f.menu.showOverlay(F("Saved"), 1000);
+    assertTrue(f.menu.hasOverlay());
+    assertTrue(f.display.shows(0, "~Start"));
+    assertTrue(f.display.shows(1, "     Saved      "));
+
+    f.menu.refresh();
+    f.clock.advance(999);
+    f.menu.poll();
+    assertTrue(f.display.shows(1, "     Saved      "));
+
+    f.display.writes = 0;
+    f.clock.advance(1);
+    f.menu.poll();
+    assertFalse(f.menu.hasOverlay());
+    assertTrue(f.display.shows(1, " Stop"));
+    // The delayed refresh redraws the whole screen
+    assertEqual(2 * LCD_COLS, f.display.writes);
+    assertEqual(0, f.display.clears);
+}
+
+unittest(only_the_covered_row_is_restored) {
+    Fixture f;
+    f.menu.showOverlay("Saved", 1000);
+    f.display.writes = 0;
+
+    f.clock.advance(1000);
+    f.menu.poll();
+
+    assertTrue(f.display.shows(1, " Stop"));
+    assertEqual(LCD_COLS, f.display.writes);
+}
+
+unittest(shorter_message_restores_the_rows_it_leaves) {
+    Fixture f;
+    f.menu.showOverlay("Saving...\nPlease wait", 0, true);
+    f.menu.showOverlay("Saved", 1000);
+
+    assertTrue(f.menu.hasOverlay());
+    assertTrue(f.display.shows(0, "~Start"));
+    assertTrue(f.display.shows(1, "     Saved      "));
+
+    f.clock.advance(1000);
+    f.menu.poll();
+    assertTrue(f.display.shows(0, "~Start"));
+    assertTrue(f.display.shows(1, " Stop"));
+}
+
+unittest(input_dismisses_the_message_then_goes_to_the_menu) {
+    Fixture f;
+    f.menu.showOverlay("Out of range", 0);
+
+    f.menu.process(DOWN);
+
+    assertFalse(f.menu.hasOverlay());
+    assertEqual((uint8_t)1, f.menu.getCursor());
+    assertTrue(f.display.shows(1, "~Stop"));
+}
+
+unittest(question_takes_the_input_until_it_is_answered) {
+    Fixture f;
+    f.menu.showOverlay("Reset all?\nENTER:yes BACK:no", 0, true, answer);
+    assertTrue(f.display.shows(0, "   Reset all?   "));
+    assertTrue(f.display.shows(1, "ENTER:yes BACK:n"));
+
+    assertTrue(f.menu.process(DOWN));
+    assertTrue(f.menu.hasOverlay());
+    assertEqual((uint8_t)0, f.menu.getCursor());
+    assertEqual(0, answers);
+
+    f.menu.process(ENTER);
+    assertFalse(f.menu.hasOverlay());
+    assertEqual(1, answers);
+    assertTrue(lastAnswer);
+    assertTrue(f.display.shows(0, "~Start"));
+    assertTrue(f.display.shows(1, " Stop"));
+}
+
+unittest(question_times_out_as_no) {
+    Fixture f;
+    f.menu.showOverlay("Reset all?", 3000, true, answer);
+
+    f.clock.advance(3000);
+    f.menu.poll();
+
+    assertFalse(f.menu.hasOverlay());
+    assertEqual(1, answers);
+    assertFalse(lastAnswer);
+}
+
+unittest_main()
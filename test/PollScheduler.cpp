@@ -0,0 +1,141 @@
+#include <ArduinoUnitTests.h>
+#include <LcdMenu.h>
+#include <MenuScreen.h>
+
+#include "support/MenuFixture.h"
+
+#define LCD_ROWS 4
+#define LCD_COLS 16
+
+// Polled items are redrawn at their own interval, a few rows per poll.
+
+class PolledItem : public MenuItem {
+  public:
+    uint16_t draws = 0;
+    PolledItem(const char* text, bool polled = true) : MenuItem(text) { polling = polled; }
+    void draw(MenuRenderer* renderer) override {
+        draws++;
+        MenuItem::draw(renderer);
+    }
+};
+
+PolledItem rpm("RPM");
+PolledItem temperature("Temp");
+PolledItem pressure("Press");
+PolledItem humidity("Hum");
+MenuItem label("Label");
+MenuScreen* screen = new MenuScreen({&rpm, &temperature, &pressure, &humidity, &label});
+
+struct Fixture : MenuFixture<LCD_COLS, LCD_ROWS> {
+    Fixture() {
+        start(screen);
+        for (PolledItem* item : {&rpm, &temperature, &pressure, &humidity}) {
+            item->setPollInterval(0);
+            item->draws = 0;
+        }
+    }
+    uint16_t draws() const { return rpm.draws + temperature.draws + pressure.draws + humidity.draws; }
+    // Polls every 10ms for `ms` milliseconds
+    void run(unsigned long ms, uint16_t interval = 1000) {
+        for (unsigned long t = 0; t < ms; t += 10) {
+            clock.advance(10);
+            menu.poll(interval);
+        }
+    }
+};
+
+unittest(items_are_polled_at_their_own_interval) {
+    Fixture f;
+    f.clock.advance(1000);
+    rpm.setPollInterval(100);
+    temperature.setPollInterval(2000);
+
+    f.run(10000);
+
+    assertEqual(100, rpm.draws);
+    assertEqual(5, temperature.draws);
+    // The menu's interval
+    assertEqual(10, pressure.draws);
+    assertEqual(10, humidity.draws);
+}
+
+unittest(rows_due_together_are_spread_over_polls) {
+    Fixture f;
+    f.clock.advance(1000);
+
+    for (uint8_t i = 0; i < 10; i++) {
+        uint16_t before = f.draws();
+        f.clock.advance(10);
+        f.menu.poll(1000);
+        assertTrue(f.draws() - before <= POLL_ROWS_PER_TICK);
+    }
+    assertEqual(1, rpm.draws);
+    assertEqual(1, humidity.draws);
+
+    // The rows stay spread
+    f.run(910);
+    assertEqual(2, rpm.draws);
+    assertEqual(1, humidity.draws);
+    f.run(10);
+    assertEqual(2, humidity.draws);
+}
+
+unittest(scrolled_in_items_start_their_own_interval) {
+    Fixture f;
+    for (PolledItem* item : {&rpm, &temperature, &pressure, &humidity}) item->setPollInterval(2000);
+    f.run(1900);
+    assertEqual(0, f.draws());
+
+    // Temp, Press and Hum move up a row and are drawn now
+    for (uint8_t i = 0; i < 4; i++) f.menu.process(DOWN);
+    assertEqual((uint8_t)1, f.menu.getScreen()->getView());
+    for (PolledItem* item : {&rpm, &temperature, &pressure, &humidity}) item->draws = 0;
+
+    // The rows they left were due, they are not
+    f.run(1000);
+    assertEqual(0, f.draws());
+    f.run(1100);
+    assertEqual(3, f.draws());
+    for (PolledItem* item : {&rpm, &temperature, &pressure, &humidity}) item->setPollInterval(0);
+}
+
+unittest(nothing_is_polled_while_editing) {
+    Fixture f;
+    f.clock.advance(1000);
+    f.renderer.beginEdit();
+    f.run(5000);
+    f.renderer.endEdit();
+
+    assertEqual(0, f.draws());
+}
+
+unittest(rows_past_the_tracked_ones_are_polled_at_the_menu_interval) {
+    const uint8_t rows = POLL_MAX_ROWS + 2;
+    std::vector<MenuItem*> items;
+    for (uint8_t i = 0; i < POLL_MAX_ROWS; i++) items.push_back(&label);
+    PolledItem flow("Flow");
+    PolledItem level("Level", false);
+    items.push_back(&flow);
+    items.push_back(&level);
+    MenuScreen tall(items);
+    MenuFixture<LCD_COLS, rows> f;
+    f.start(&tall);
+    flow.setPollInterval(100);
+    flow.draws = level.draws = 0;
+
+    for (uint16_t t = 0; t < 10000; t += 10) {
+        f.clock.advance(10);
+        f.menu.poll(1000);
+    }
+    assertEqual(10, flow.draws);
+    assertEqual(0, level.draws);
+
+    // A dirty row redraws the rows past the tracked ones
+    level.markDirty();
+    f.clock.advance(10);
+    f.menu.poll(1000);
+    assertEqual(11, flow.draws);
+    assertEqual(1, level.draws);
+}
+
+unittest_main()
@@ -0,0 +1,178 @@
+#include <ArduinoUnitTests.h>
+#include <ItemBool.h>
+#include <ItemList.h>
+#include <ItemRange.h>
+#include <LcdMenu.h>
+#include <MenuScreen.h>
+#include <input/RemoteControl.h>
+
+#include "support/MenuFixture.h"
+
+#define LCD_ROWS 2
+#define LCD_COLS 16
+
+// Counts how often the screen is drawn
+class DrawCounter : public MenuItem {
+  public:
+    uint16_t draws = 0;
+    DrawCounter() : MenuItem("Draws") {}
+    void draw(MenuRenderer* renderer) override {
+        draws++;
+        MenuItem::draw(renderer);
+    }
+};
+
+// Reads `input`, keeps what is written in `output`
+class BufferStream : public Stream {
+  public:
+    std::string input;
+    std::string output;
+    size_t position = 0;
+    int available() override { return input.size() - position; }
+    int read() override { return position < input.size() ? (uint8_t)input[position++] : -1; }
+    int peek() override { return position < input.size() ? (uint8_t)input[position] : -1; }
+    size_t write(uint8_t byte) override {
+        output.push_back(static_cast<char>(byte));
+        return 1;
+    }
+};
+
+std::vector<const char*> modes = {"Off", "Eco", "Full"};
+float gain = 1.0f;
+
+DrawCounter counter;
+MenuItem* volume = ITEM_RANGE<int>("Volume", 5, 1, 0, 10, NULL, "%d");
+MenuItem* mode = ITEM_LIST("Mode", modes, NULL);
+MenuScreen* mainScreen = new MenuScreen({&counter, volume, mode});
+MenuItem* enabled = ITEM_BOOL("Enabled", false, "ON", "OFF", NULL);
+MenuItem* gainItem = ITEM_RANGE_REF<float>("Gain", gain, 0.5f, 0.0f, 4.0f, NULL, "%.1f");
+MenuScreen* settingsScreen = new MenuScreen({enabled, gainItem});
+
+std::string frame(const std::string& payload) {
+    uint8_t crc = 0;
+    for (char c : payload) crc = RemoteControl::crc8(crc, (uint8_t)c);
+    std::string request;
+    request.push_back((char)RemoteControl::REQUEST_SYNC);
+    request.push_back((char)payload.size());
+    request += payload;
+    request.push_back((char)crc);
+    return request;
+}
+
+std::string value(char type, int32_t value) {
+    std::string bytes(1, type);
+    bytes.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    return bytes;
+}
+
+std::string value(float value) {
+    std::string bytes(1, 'f');
+    bytes.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    return bytes;
+}
+
+int32_t recordInteger(const std::string& response, uint8_t record) {
+    int32_t value;
+    memcpy(&value, response.data() + 3 + record * RemoteControl::RECORD_SIZE + 2, sizeof(value));
+    return value;
+}
+
+uint8_t recordStatus(const std::string& response, uint8_t record) {
+    return response[3 + record * RemoteControl::RECORD_SIZE];
+}
+
+struct Fixture : MenuFixture<LCD_COLS, LCD_ROWS> {
+    BufferStream stream;
+    RemoteControl remote;
+    Fixture() : remote(&menu, &stream) {
+        start(mainScreen);
+        counter.draws = 0;
+    }
+};
+
+unittest(remote_sets_a_batch_and_refreshes_once) {
+    Fixture f;
+    std::string payload;
+    payload += std::string("SP\0\1\0", 5) + value('i', 8);
+    payload += std::string("SP\0\2\0", 5) + value('i', 2);
+    payload += std::string("GP\0\1\0", 5);
+    f.stream.input = frame(payload);
+
+    f.remote.observe();
+
+    assertEqual(3 + 3 * RemoteControl::RECORD_SIZE + 1, f.stream.output.size());
+    assertEqual((uint8_t)RemoteControl::RESPONSE_SYNC, (uint8_t)f.stream.output[0]);
+    assertEqual(RemoteControl::OK, f.stream.output[1]);
+    assertEqual(3, f.stream.output[2]);
+    assertEqual(8, recordInteger(f.stream.output, 2));
+    assertEqual(2, static_cast<BaseWidgetValue<uint8_t>*>(mode->getWidgetAt(0))->getValue());
+    assertEqual(1, counter.draws);
+}
+
+unittest(remote_clamps_values_and_reports_bad_addresses) {
+    Fixture f;
+    std::string payload;
+    payload += std::string("SP\0\1\0", 5) + value('i', 42);
+    payload += std::string("SP\0\2\0", 5) + value('i', 1);
+    // Position past the end of the list
+    payload += std::string("SP\0\2\0", 5) + value('i', 7);
+    payload += std::string("GP\0\7\0", 5);
+    payload += std::string("GP\0\1\1", 5);
+    payload += std::string("GP\0\0\0", 5);
+    f.stream.input = frame(payload);
+
+    f.remote.observe();
+
+    assertEqual(RemoteControl::OK, recordStatus(f.stream.output, 0));
+    assertEqual(10, recordInteger(f.stream.output, 0));
+    assertEqual(RemoteControl::OK, recordStatus(f.stream.output, 2));
+    assertEqual(1, recordInteger(f.stream.output, 2));
+    assertEqual(RemoteControl::NO_ITEM, recordStatus(f.stream.output, 3));
+    assertEqual(RemoteControl::NO_WIDGET, recordStatus(f.stream.output, 4));
+    assertEqual(RemoteControl::NO_WIDGET, recordStatus(f.stream.output, 5));
+}
+
+unittest(remote_addresses_other_screens_and_ids) {
+    Fixture f;
+    assertEqual(1, f.remote.addScreen(settingsScreen));
+    assertTrue(f.remote.bind(0x0102, gainItem));
+    std::string payload;
+    payload += std::string("SP\1\0\0", 5) + value('i', 1);
+    payload += std::string("SI\2\1\0", 5) + value(2.5f);
+    f.stream.input = frame(payload);
+
+    f.remote.observe();
+
+    assertEqual(2, f.stream.output[2]);
+    assertTrue(static_cast<BaseWidgetValue<bool>*>(enabled->getWidgetAt(0))->getValue());
+    assertEqual(2.5f, gain);
+    assertEqual('f', f.stream.output[3 + RemoteControl::RECORD_SIZE + 1]);
+}
+
+unittest(remote_rejects_bad_frames_without_executing) {
+    Fixture f;
+    std::string request = frame(std::string("SP\0\1\0", 5) + value('i', 3));
+    request[request.size() - 1] ^= 0xFF;
+    f.stream.input = request + frame("X");
+
+    f.remote.observe();
+
+    assertEqual(8, f.stream.output.size());
+    assertEqual(RemoteControl::BAD_CHECKSUM, f.stream.output[1]);
+    assertEqual(0, f.stream.output[2]);
+    assertEqual(RemoteControl::MALFORMED, f.stream.output[5]);
+    assertEqual(0, counter.draws);
+}
+
+unittest(remote_sends_commands_to_the_menu) {
+    Fixture f;
+    f.stream.input = frame("K\x81");
+
+    f.remote.observe();
+
+    assertEqual(RemoteControl::OK, recordStatus(f.stream.output, 0));
+    assertEqual(1, recordInteger(f.stream.output, 0));
+    assertEqual(1, f.menu.getCursor());
+}
+
+unittest_main()
@@ -0,0 +1,89 @@
+#include "Godmode.h"
+#include <ArduinoUnitTests.h>
+#include <ItemValue.h>
+#include <LcdMenu.h>
+#include <MenuScreen.h>
+#include <diagnostics/ProfilingDisplay.h>
+#include <diagnostics/RenderProfiler.h>
+#include <renderer/CharacterDisplayRenderer.h>
+
+#include "support/GridDisplay.h"
+
+/**
+ * Takes 4 ms to draw, like a float formatted on AVR.
+ */
+class SlowItem : public MenuItem {
+  public:
+    SlowItem(const char* text) : MenuItem(text) {}
+
+  protected:
+    void draw(MenuRenderer* renderer) override {
+        GODMODE()->micros += 4000;
+        MenuItem::draw(renderer);
+    }
+};
+
+float temperature = 21.5;
+
+// clang-format off
+MENU_SCREEN(mainScreen, mainItems,
+    ITEM_BASIC("First"),
+    new SlowItem("Slow"),
+    ITEM_VALUE("Temp", temperature, "%.1f"),
+    ITEM_BASIC("Last"));
+// clang-format on
+
+unittest(render_profiler_attributes_draws_time_and_bytes) {
+    RenderProfiler profiler;
+    GridDisplay<16, 2> stub;
+    ProfilingDisplay display(&stub, &profiler);
+    CharacterDisplayRenderer renderer(&display, 16, 2);
+    LcdMenu menu(renderer);
+    renderer.begin();
+    renderer.setProfiler(&profiler);
+    GODMODE()->micros = 1000000;
+
+    menu.setScreen(mainScreen);
+    menu.process(DOWN);
+
+    const RenderProfiler::Entry* first = profiler.find(mainItems[0]);
+    const RenderProfiler::Entry* slow = profiler.find(mainItems[1]);
+    assertNotNull(first);
+    assertNotNull(slow);
+    assertEqual(2, first->draws);
+    assertEqual(1, first->processes);
+    assertEqual(2, slow->draws);
+    assertEqual(8000, slow->totalMicros);
+    assertEqual(4000, slow->maxMicros);
+    assertEqual(0, first->maxMicros);
+    // 16 characters and 2 cursor moves per row, plus one to place the focus
+    assertEqual(18 + 19, first->bytes);
+    assertEqual(18 + 19, slow->bytes);
+    assertNull(profiler.find(mainItems[2]));
+
+    menu.process(DOWN);
+    const RenderProfiler::Entry* value = profiler.find(mainItems[2]);
+    assertNotNull(value);
+    assertEqual(1, value->draws);
+    assertEqual(3, profiler.getEntryCount());
+}
+
+unittest(render_profiler_is_optional) {
+    RenderProfiler profiler;
+    GridDisplay<16, 2> stub;
+    CharacterDisplayRenderer renderer(&stub, 16, 2);
+    LcdMenu menu(renderer);
+    renderer.begin();
+
+    menu.setScreen(mainScreen);
+    menu.process(DOWN);
+    assertEqual(0, profiler.getEntryCount());
+
+    renderer.setProfiler(&profiler);
+    menu.process(UP);
+    assertEqual(2, profiler.getEntryCount());
+    profiler.clear();
+    assertEqual(0, profiler.getEntryCount());
+}
+
+unittest_main()
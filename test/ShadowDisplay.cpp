@@ -0,0 +1,156 @@
+#include <ArduinoUnitTests.h>
+#include <display/ShadowDisplay.h>
+
+#define LCD_ROWS 2
+#define LCD_COLS 16
+
+// A panel that can lose its content and its bus
+class FlakyPanel : public CharacterDisplayInterface {
+  public:
+    char cells[LCD_ROWS][LCD_COLS];
+    uint8_t col = 0;
+    uint8_t row = 0;
+    uint8_t busStatus = 0;
+    uint16_t begins = 0;
+    uint16_t clears = 0;
+    uint16_t writes = 0;
+    uint16_t glyphs = 0;
+    FlakyPanel() { corrupt(' '); }
+    void corrupt(char c) { memset(cells, c, sizeof(cells)); }
+    void begin() override {
+        begins++;
+        corrupt(' ');
+    }
+    void clear() override {
+        clears++;
+        corrupt(' ');
+    }
+    void show() override {}
+    void hide() override {}
+    void draw(uint8_t byte) override {
+        writes++;
+        if (col < LCD_COLS && row < LCD_ROWS) cells[row][col] = byte;
+        col++;
+    }
+    void draw(const char* text) override {
+        while (*text) draw((uint8_t)*text++);
+    }
+    void setCursor(uint8_t c, uint8_t r) override {
+        col = c;
+        row = r;
+    }
+    void setBacklight(bool) override {}
+    void createChar(uint8_t, uint8_t*) override { glyphs++; }
+    void drawBlinker() override {}
+    void clearBlinker() override {}
+    uint8_t getBusStatus() override { return busStatus; }
+    bool shows(uint8_t r, const char* text) const { return strncmp(cells[r], text, strlen(text)) == 0; }
+};
+
+struct Fixture {
+    SimulatedClock clock;
+    FlakyPanel panel;
+    ShadowDisplay shadow;
+    Fixture(uint16_t scrubInterval = 250) : shadow(&panel, LCD_COLS, LCD_ROWS, scrubInterval) {
+        shadow.setClock(&clock);
+        shadow.begin();
+        shadow.setCursor(0, 0);
+        shadow.draw("Settings");
+        shadow.setCursor(0, 1);
+        shadow.draw("Volume");
+    }
+    // Calls update every millisecond for `ms` milliseconds
+    void run(unsigned long ms) {
+        for (unsigned long t = 0; t < ms; t++) {
+            clock.advance(1);
+            shadow.update();
+        }
+    }
+};
+
+unittest(shadow_keeps_a_copy_of_the_panel) {
+    Fixture f;
+    assertEqual('S', f.shadow.getCell(0, 0));
+    assertEqual('V', f.shadow.getCell(0, 1));
+    assertEqual(' ', f.shadow.getCell(6, 1));
+    assertTrue(f.panel.shows(1, "Volume"));
+
+    f.shadow.clear();
+    assertEqual(' ', f.shadow.getCell(0, 0));
+}
+
+unittest(scrub_repairs_a_corrupted_panel_without_clearing) {
+    Fixture f;
+    f.panel.corrupt('#');
+
+    // One row per interval: both rows are back within rows * interval
+    f.run(LCD_ROWS * 250);
+
+    assertTrue(f.panel.shows(0, "Settings        "));
+    assertTrue(f.panel.shows(1, "Volume          "));
+    assertEqual(0, f.panel.clears);
+    assertEqual(1, f.panel.begins);
+    // The cursor is put back where the menu left it
+    assertEqual(6, f.panel.col);
+    assertEqual(1, f.panel.row);
+}
+
+unittest(bus_error_backs_off_then_resyncs) {
+    Fixture f;
+    uint8_t glyph[8] = {0};
+    f.shadow.createChar(0, glyph);
+    f.panel.busStatus = 2;
+
+    f.run(250);
+    assertFalse(f.shadow.isHealthy());
+    assertEqual(1, f.shadow.getFaultCount());
+
+    // Retries after 50, 100, 200, 400 ms while the bus is down
+    uint16_t writes = f.panel.writes;
+    f.run(750);
+    assertEqual(writes, f.panel.writes);
+    assertEqual(1, f.panel.begins);
+
+    f.panel.busStatus = 0;
+    f.panel.corrupt('#');
+    f.run(800);
+    assertTrue(f.shadow.isHealthy());
+    assertEqual(1, f.shadow.getResyncCount());
+    assertEqual(2, f.panel.begins);
+    assertEqual(2, f.panel.glyphs);
+    assertTrue(f.panel.shows(0, "Settings"));
+    assertTrue(f.panel.shows(1, "Volume"));
+}
+
+unittest(bus_is_watched_without_scrubbing) {
+    Fixture f(0);
+    f.panel.corrupt('#');
+    f.run(1000);
+    // Nothing is rewritten while the bus is healthy
+    assertTrue(f.panel.shows(0, "################"));
+
+    f.panel.busStatus = 2;
+    f.run(SHADOW_DISPLAY_BUS_CHECK);
+    assertFalse(f.shadow.isHealthy());
+    assertEqual(1, f.shadow.getFaultCount());
+
+    f.panel.busStatus = 0;
+    f.run(SHADOW_DISPLAY_MIN_RETRY);
+    assertTrue(f.shadow.isHealthy());
+    assertEqual(1, f.shadow.getResyncCount());
+    assertTrue(f.panel.shows(0, "Settings"));
+}
+
+unittest(nothing_is_sent_while_hidden) {
+    Fixture f;
+    f.shadow.hide();
+    uint16_t writes = f.panel.writes;
+    f.panel.busStatus = 2;
+
+    f.run(5000);
+
+    assertEqual(writes, f.panel.writes);
+    assertEqual(0, f.shadow.getFaultCount());
+}
+
+unittest_main()
@@ -0,0 +1,107 @@
+#include <ArduinoUnitTests.h>
+#include <ItemRange.h>
+#include <ItemValue.h>
+#include <LcdMenu.h>
+#include <MenuScreen.h>
+#include <SharedValue.h>
+#include <renderer/MenuRenderer.h>
+
+#include "support/GridDisplay.h"
+
+#define LCD_ROWS 2
+#define LCD_COLS 16
+
+// Values written by a task or an ISR are read as a whole, never half updated.
+
+// A value whose copy can be interrupted between its two halves
+struct Pair;
+void (*interrupt)() = NULL;
+
+struct Pair {
+    uint32_t first = 0;
+    uint32_t second = 0;
+    Pair() {}
+    Pair(uint32_t value) : first(value), second(value) {}
+    Pair(const Pair& other) : first(other.first) {
+        if (interrupt != NULL) {
+            void (*isr)() = interrupt;
+            interrupt = NULL;
+            isr();
+        }
+        second = other.second;
+    }
+    Pair& operator=(const Pair& other) {
+        first = other.first;
+        second = other.second;
+        return *this;
+    }
+};
+
+SharedValue<Pair> shared(Pair(1));
+
+class CaptureRenderer : public MenuRenderer {
+  public:
+    GridDisplay<LCD_COLS, LCD_ROWS> display;
+    std::string lastValue;
+    CaptureRenderer() : MenuRenderer(&display, LCD_COLS, LCD_ROWS) {}
+    void draw(uint8_t) override {}
+    void drawItem(const char*, const char* value, bool) override { lastValue = value ? value : ""; }
+    void clearBlinker() override {}
+    void drawBlinker() override {}
+    uint8_t getEffectiveCols() const override { return maxCols; }
+};
+
+SharedValue<float> temperature(20.5f);
+SharedValue<int> setpoint(40);
+
+// clang-format off
+MENU_SCREEN(sharedScreen, sharedItems,
+    ITEM_RANGE_REF<int>("Setpoint", setpoint, 5, 0, 50, NULL, "%d"),
+    ITEM_VALUE("Temp", temperature, "%.1f"));
+// clang-format on
+
+unittest(load_retries_when_the_value_is_rewritten_during_the_copy) {
+    // Two writes land in the slot being copied
+    interrupt = []() {
+        shared.store(Pair(2));
+        shared.store(Pair(3));
+    };
+
+    Pair value = shared.load();
+
+    assertEqual(value.first, value.second);
+    assertEqual(3, value.second);
+}
+
+unittest(a_write_to_the_other_slot_does_not_tear) {
+    shared.store(Pair(5));
+    interrupt = []() { shared.store(Pair(6)); };
+
+    Pair value = shared.load();
+
+    assertEqual(value.first, value.second);
+}
+
+unittest(items_draw_and_edit_shared_values) {
+    CaptureRenderer renderer;
+    LcdMenu menu(renderer);
+    menu.setScreen(sharedScreen);
+    assertEqual("20.5", renderer.lastValue.c_str());
+
+    menu.process(ENTER);
+    menu.process(UP);
+    menu.process(ENTER);
+    assertEqual(45, setpoint.load());
+
+    temperature.store(21.5f);
+    menu.refresh();
+    assertEqual("21.5", renderer.lastValue.c_str());
+
+    WidgetNumber number;
+    assertTrue(sharedItems[0]->getWidgetAt(0)->writeNumber(WidgetNumber::fromInteger(70)));
+    assertEqual(50, setpoint.load());
+    assertTrue(sharedItems[0]->getWidgetAt(0)->readNumber(number));
+    assertEqual(50, number.toInteger());
+}
+
+unittest_main()
@@ -0,0 +1,96 @@
+#include <ArduinoUnitTests.h>
+#include <LcdMenu.h>
+#include <MenuScreen.h>
+#include <StatusBar.h>
+
+#include "support/MenuFixture.h"
+
+#define LCD_ROWS 4
+#define LCD_COLS 20
+
+// A status bar on row 0, the menu on rows 1 to 3.
+
+// clang-format off
+MENU_SCREEN(mainScreen, mainItems,
+    ITEM_BASIC("Start"),
+    ITEM_BASIC("Stop"),
+    ITEM_BASIC("Status"),
+    ITEM_BASIC("Logs"),
+    ITEM_BASIC("About"));
+// clang-format on
+
+uint8_t minutes = 0;
+bool alarm = false;
+void drawClock(char* buffer, uint8_t width) { snprintf(buffer, width + 1, "12:%02d", minutes); }
+void drawAlarm(char* buffer, uint8_t width) { snprintf(buffer, width + 1, alarm ? "AL" : ""); }
+
+struct Fixture : MenuFixture<LCD_COLS, LCD_ROWS> {
+    StatusBar status;
+    Fixture() : status(&menu, 0) {
+        renderer.setViewport(1, 3);
+        start(mainScreen);
+        minutes = 0;
+        alarm = false;
+        status.addField(0, 5, drawClock, 1000);
+        status.addField(18, 2, drawAlarm, 0);
+        status.update();
+        display.resetCounts();
+    }
+};
+
+unittest(menu_is_drawn_below_the_status_bar) {
+    Fixture f;
+    assertEqual((uint8_t)3, f.renderer.getMaxRows());
+    assertTrue(f.display.shows(0, "12:00"));
+    assertTrue(f.display.shows(1, "~Start"));
+    assertTrue(f.display.shows(3, " Status"));
+
+    for (uint8_t i = 0; i < 3; i++) f.menu.process(DOWN);
+
+    assertEqual((uint8_t)1, f.menu.getScreen()->getView());
+    assertTrue(f.display.shows(1, " Stop"));
+    assertTrue(f.display.shows(3, "~Logs"));
+    assertTrue(f.display.shows(0, "12:00"));
+    assertEqual(0, f.display.rowWrites[0]);
+}
+
+unittest(fields_update_only_the_cells_that_changed) {
+    Fixture f;
+    minutes = 1;
+    f.clock.advance(999);
+    f.status.update();
+    assertEqual(0, f.display.rowWrites[0]);
+
+    f.clock.advance(1);
+    f.status.update();
+    assertTrue(f.display.shows(0, "12:01"));
+    assertEqual(1, f.display.rowWrites[0]);
+    assertEqual(0, f.display.rowWrites[1] + f.display.rowWrites[2] + f.display.rowWrites[3]);
+}
+
+unittest(fields_without_interval_update_when_marked_dirty) {
+    Fixture f;
+    alarm = true;
+    f.clock.advance(5000);
+    f.status.update();
+    assertEqual(' ', f.display.cells[0][18]);
+
+    f.status.markDirty(1);
+    f.status.update();
+    assertEqual('A', f.display.cells[0][18]);
+    assertEqual('L', f.display.cells[0][19]);
+}
+
+unittest(status_bar_waits_while_the_menu_is_hidden) {
+    Fixture f;
+    f.menu.hide();
+    f.clock.advance(1000);
+    f.status.update();
+    assertEqual(0, f.display.rowWrites[0]);
+
+    f.menu.show();
+    f.status.update();
+    assertTrue(f.display.shows(0, "12:00"));
+}
+
+unittest_main()
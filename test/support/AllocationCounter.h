@@ -0,0 +1,95 @@
+#pragma once
+
+/**
+ * @file AllocationCounter.h
+ * @brief Counting `operator new` / `operator delete` for the native tests and the benchmarks.
+ *
+ * Replaces the global allocation operators, so include it from exactly one
+ * source file per binary. Measure with an `AllocationScope`, or subtract two
+ * copies of `allocationStats()`:
+ *
+ * ```
+ * AllocationScope heap;
+ * menu.process(DOWN);
+ * assertEqual(0, heap.allocations());
+ * ```
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <new>
+
+struct AllocationStats {
+    size_t allocations = 0;
+    size_t frees = 0;
+    size_t bytesAllocated = 0;
+    size_t liveBytes = 0;
+    size_t peakLiveBytes = 0;
+};
+
+inline AllocationStats& allocationStats() {
+    static AllocationStats stats;
+    return stats;
+}
+
+/**
+ * @brief Allocations, frees and peak bytes from construction on.
+ */
+class AllocationScope {
+    AllocationStats start;
+
+  public:
+    AllocationScope() {
+        AllocationStats& stats = allocationStats();
+        stats.peakLiveBytes = stats.liveBytes;
+        start = stats;
+    }
+    size_t allocations() const { return allocationStats().allocations - start.allocations; }
+    size_t frees() const { return allocationStats().frees - start.frees; }
+    /**
+     * @brief Bytes allocated and not freed since construction.
+     */
+    long leakedBytes() const { return (long)allocationStats().liveBytes - (long)start.liveBytes; }
+    /**
+     * @brief Highest number of bytes live at once on top of what was live at construction.
+     */
+    size_t peakBytes() const { return allocationStats().peakLiveBytes - start.liveBytes; }
+};
+
+namespace allocation_counter {
+
+// Every block is prefixed with its size so frees can be accounted for.
+union Header {
+    size_t size;
+    max_align_t align;
+};
+
+inline void* allocate(size_t size) {
+    Header* header = static_cast<Header*>(malloc(sizeof(Header) + size));
+    if (header == NULL) throw std::bad_alloc();
+    header->size = size;
+    AllocationStats& stats = allocationStats();
+    stats.allocations++;
+    stats.bytesAllocated += size;
+    stats.liveBytes += size;
+    if (stats.liveBytes > stats.peakLiveBytes) stats.peakLiveBytes = stats.liveBytes;
+    return header + 1;
+}
+
+inline void release(void* ptr) {
+    if (ptr == NULL) return;
+    Header* header = static_cast<Header*>(ptr) - 1;
+    AllocationStats& stats = allocationStats();
+    stats.frees++;
+    stats.liveBytes -= header->size;
+    free(header);
+}
+
+}  // namespace allocation_counter
+
+void* operator new(size_t size) { return allocation_counter::allocate(size); }
+void* operator new[](size_t size) { return allocation_counter::allocate(size); }
+void operator delete(void* ptr) noexcept { allocation_counter::release(ptr); }
+void operator delete[](void* ptr) noexcept { allocation_counter::release(ptr); }
+void operator delete(void* ptr, size_t) noexcept { allocation_counter::release(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { allocation_counter::release(ptr); }
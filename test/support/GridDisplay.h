@@ -0,0 +1,122 @@
+#pragma once
+
+/**
+ * @file GridDisplay.h
+ * @brief Character display for the native tests that keeps what is drawn in a grid of cells.
+ *
+ * Tests read the cells to check what the display shows, and the counters to
+ * check what it cost to draw:
+ *
+ * ```
+ * GridDisplay<16, 2> display;
+ * ...
+ * assertTrue(display.shows(1, " Stop"));
+ * assertEqual(16, display.writes);
+ * ```
+ */
+
+#include <display/CharacterDisplayInterface.h>
+#include <string.h>
+
+template <uint8_t COLS, uint8_t ROWS>
+class GridDisplay : public CharacterDisplayInterface {
+  public:
+    /**
+     * @brief Characters shown, each row ends with a `\0`.
+     */
+    char cells[ROWS][COLS + 1];
+    /**
+     * @brief Custom characters uploaded to each slot.
+     */
+    uint8_t glyphs[8][8] = {};
+    uint8_t col = 0;
+    uint8_t row = 0;
+
+    uint16_t clears = 0;
+    uint16_t cursorMoves = 0;
+    uint16_t uploads = 0;
+    /**
+     * @brief Characters drawn, on the grid or not.
+     */
+    uint16_t writes = 0;
+    /**
+     * @brief Characters drawn on each row of the grid.
+     */
+    uint16_t rowWrites[ROWS] = {};
+    /**
+     * @brief Characters drawn after `createChar` without a `setCursor` first,
+     * an HD44780 writes them to the glyph memory instead of the screen.
+     */
+    uint16_t misplaced = 0;
+    /**
+     * @brief Whether characters go to the glyph memory, as they do after `createChar`.
+     */
+    bool inGlyphMemory = false;
+    uint16_t showCalls = 0;
+    uint16_t hideCalls = 0;
+    uint16_t backlightOn = 0;
+    uint16_t backlightOff = 0;
+
+    GridDisplay() { wipe(); }
+    void begin() override { wipe(); }
+    void clear() override {
+        clears++;
+        wipe();
+        col = 0;
+        row = 0;
+        inGlyphMemory = false;
+    }
+    void show() override { showCalls++; }
+    void hide() override { hideCalls++; }
+    void draw(uint8_t byte) override {
+        writes++;
+        if (inGlyphMemory) misplaced++;
+        if (col < COLS && row < ROWS) {
+            cells[row][col] = byte;
+            rowWrites[row]++;
+        }
+        col++;
+    }
+    void draw(const char* text) override {
+        while (*text) draw((uint8_t)*text++);
+    }
+    void setCursor(uint8_t c, uint8_t r) override {
+        cursorMoves++;
+        col = c;
+        row = r;
+        inGlyphMemory = false;
+    }
+    void setBacklight(bool enabled) override { enabled ? backlightOn++ : backlightOff++; }
+    void createChar(uint8_t id, uint8_t* rows) override {
+        uploads++;
+        memcpy(glyphs[id & 7], rows, 8);
+        inGlyphMemory = true;
+    }
+    void drawBlinker() override {}
+    void clearBlinker() override {}
+
+    /**
+     * @brief Check if row `r` starts with `text`.
+     */
+    bool shows(uint8_t r, const char* text) const { return strncmp(cells[r], text, strlen(text)) == 0; }
+    /**
+     * @brief Bytes an HD44780 would get: one per command or character, nine per uploaded glyph.
+     */
+    uint16_t busBytes() const { return clears + cursorMoves + writes + 9 * uploads; }
+    /**
+     * @brief Set every counter back to `0`, the cells are kept.
+     */
+    void resetCounts() {
+        clears = cursorMoves = uploads = writes = misplaced = 0;
+        showCalls = hideCalls = backlightOn = backlightOff = 0;
+        memset(rowWrites, 0, sizeof(rowWrites));
+    }
+
+  private:
+    void wipe() {
+        for (uint8_t r = 0; r < ROWS; r++) {
+            memset(cells[r], ' ', COLS);
+            cells[r][COLS] = '\0';
+        }
+    }
+};
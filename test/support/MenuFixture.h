@@ -0,0 +1,38 @@
+#pragma once
+
+/**
+ * @file MenuFixture.h
+ * @brief A menu drawn on a `GridDisplay` and timed by a simulated clock.
+ *
+ * Test fixtures derive from it, set the renderer up then call `start`:
+ *
+ * ```
+ * struct Fixture : MenuFixture<16, 2> {
+ *     Fixture() {
+ *         renderer.setPowerTimeouts(5000, 20000);
+ *         start(mainScreen);
+ *     }
+ * };
+ * ```
+ */
+
+#include "GridDisplay.h"
+#include <LcdMenu.h>
+#include <MenuScreen.h>
+#include <renderer/CharacterDisplayRenderer.h>
+
+template <uint8_t COLS, uint8_t ROWS, typename Renderer = CharacterDisplayRenderer>
+struct MenuFixture {
+    SimulatedClock clock;
+    GridDisplay<COLS, ROWS> display;
+    Renderer renderer;
+    LcdMenu menu;
+    MenuFixture() : renderer(&display, COLS, ROWS), menu(renderer) { renderer.setClock(&clock); }
+    /**
+     * @brief Begin the renderer and show `screen`.
+     */
+    void start(MenuScreen* screen) {
+        renderer.begin();
+        menu.setScreen(screen);
+    }
+};
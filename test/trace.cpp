@@ -0,0 +1,111 @@
+#include <ArduinoUnitTests.h>
+#include <utils/lcd_menu_trace.h>
+
+class CapturePrint : public Print {
+  public:
+    std::string captured;
+    int room = 0x7FFF;
+    size_t write(uint8_t byte) override {
+        captured.push_back(static_cast<char>(byte));
+        room--;
+        return 1;
+    }
+    int availableForWrite() override { return room; }
+};
+
+unittest(trace_text_matches_log_lines) {
+    LcdMenuTrace trace;
+    CapturePrint out;
+    char value[] = "0123456";
+
+    trace.record(F("LcdMenu::setScreen"));
+    trace.record(F("MenuScreen::down"), (uint8_t)3);
+    trace.record(F("WidgetToggle::toggle"), true);
+    trace.record(F("WidgetRange::increment"), -0.99f);
+    trace.record(F("ItemInputCharset::up"), 'A');
+    trace.record(F("ItemWidget::enter"), "Auto");
+    trace.record(F("ItemInput::left"), value);
+    // The copy is taken when recording
+    value[0] = 'X';
+    assertTrue(trace.drain(out));
+
+    assertEqual(
+        "#LOG# LcdMenu::setScreen\n"
+        "#LOG# MenuScreen::down=3\n"
+        "#LOG# WidgetToggle::toggle=1\n"
+        "#LOG# WidgetRange::increment=-0.99\n"
+        "#LOG# ItemInputCharset::up=A\n"
+        "#LOG# ItemWidget::enter=Auto\n"
+        "#LOG# ItemInput::left=0123456\n",
+        out.captured.c_str());
+    assertEqual(0, trace.size());
+}
+
+unittest(trace_drain_does_not_exceed_output_room) {
+    LcdMenuTrace trace;
+    CapturePrint out;
+    out.room = 10;
+
+    trace.record(F("MenuScreen::up"), 1);
+    assertFalse(trace.drain(out));
+    assertEqual("#LOG# Menu", out.captured.c_str());
+    assertFalse(trace.drain(out));
+    assertEqual(10, out.captured.size());
+
+    out.room = 20;
+    assertTrue(trace.drain(out));
+    assertEqual("#LOG# MenuScreen::up=1\n", out.captured.c_str());
+}
+
+unittest(trace_reports_dropped_events) {
+    LcdMenuTrace trace;
+    CapturePrint out;
+    for (uint8_t i = 0; i < LCDMENU_TRACE_CAPACITY + 2; i++) {
+        trace.record(F("MenuScreen::down"), i);
+    }
+    assertEqual(LCDMENU_TRACE_CAPACITY, trace.size());
+    assertEqual(2, trace.getDropped());
+
+    trace.flush(out);
+    assertEqual(0, out.captured.find("#LOG# LcdMenuTrace::dropped=2\n#LOG# MenuScreen::down=0\n"));
+    assertEqual(0, trace.getDropped());
+}
+
+unittest(trace_binary_sends_names_once) {
+    LcdMenuTrace trace;
+    CapturePrint out;
+    trace.setBinary(true);
+
+    trace.record(F("Up"), 7);
+    trace.record(F("Up"), 8);
+    trace.flush(out);
+
+    const uint8_t expected[] = {
+        0xA5, 'D', 0, 2, 'U', 'p',
+        0xA5, 'E', 0, LcdMenuTrace::INT};
+    assertEqual(6 + 8 + 4 + 8 + 4, out.captured.size());
+    assertEqual(0, memcmp(expected, out.captured.data(), sizeof(expected)));
+    // Value of the first event, after the timestamp
+    assertEqual(7, (uint8_t)out.captured[14]);
+    // The second event reuses the slot
+    assertEqual(0xA5, (uint8_t)out.captured[18]);
+    assertEqual('E', out.captured[19]);
+    assertEqual(8, (uint8_t)out.captured[26]);
+}
+
+unittest(trace_events_are_stamped_by_its_clock) {
+    LcdMenuTrace trace;
+    CapturePrint out;
+    SimulatedClock clock(0x01020304);
+    trace.setClock(&clock);
+    trace.setBinary(true);
+
+    trace.record(F("Up"));
+    trace.flush(out);
+
+    // Timestamp of the event, little endian after its header
+    const uint8_t time[] = {0x04, 0x03, 0x02, 0x01};
+    assertEqual(0, memcmp(time, out.captured.data() + 10, sizeof(time)));
+}
+
+unittest_main()